@@ -26,24 +26,25 @@
 
 ************************************************************************/
 
+#include <string.h>
+
 #include "filter.h"
+#include "../../fir-simd.h"
 
 // Public functions
 Filter::Filter(int _order, const double *_a, const double *_b)
 {
     order = _order + 1;
     if (_a) {
-        a.insert(b.begin(), _a, _a + order);
+        a.insert(a.begin(), _a, _a + order);
         isIIR = true;
     } else {
         a.push_back(1.0);
         isIIR = false;
     }
     b.insert(b.begin(), _b, _b + order);
-    x.resize(order);
-    y.resize(order);
 
-    clear(0);
+    init();
 }
 
 Filter::Filter(std::vector<double> _b, std::vector<double> _a)
@@ -52,16 +53,12 @@ Filter::Filter(std::vector<double> _b, std::vector<double> _a)
     a = _a;
 
     order = b.size();
-
-    x.resize(b.size() + 1);
-    y.resize(a.size() + 1);
+    isIIR = true;
 
 //			for (int i = 0; i < b.size(); i++) cerr << b[i] << endl;;
 //			for (int i = 0; i < b.size(); i++) cerr << a[i] << endl;;
 
-    clear(0);
-
-    isIIR = true;
+    init();
 }
 
 Filter::Filter(Filter *orig)
@@ -70,20 +67,19 @@ Filter::Filter(Filter *orig)
     isIIR = orig->isIIR;
     a = orig->a;
     b = orig->b;
-    x.resize(b.size());
-    y.resize(a.size());
 
-    clear(0);
+    init();
 }
 
 void Filter::clear(double val)
 {
-    for (quint16 i = 0; i < a.size(); i++) {
+    for (size_t i = 0; i < y.size(); i++) {
         y[i] = val;
     }
-    for (quint16 i = 0; i < b.size(); i++) {
+    for (size_t i = 0; i < x.size(); i++) {
         x[i] = val;
     }
+    xpos = ypos = 0;
 }
 
 void Filter::dump()
@@ -94,55 +90,145 @@ void Filter::dump()
 
 double Filter::feed(double val)
 {
-    double a0 = a[0];
-    double y0;
+    return step(val);
+}
+
+// Block versions of feed().  For IIRs and asymmetric FIRs out[i] is exactly
+// what feed(in[i]) would have returned.  Symmetric FIRs use the folded SIMD
+// kernels instead, which only match feed() to within rounding - so a stream
+// that needs reproducible results should be fed through one or the other, not
+// a mix.  The block output doesn't depend on how the input is split into
+// blocks.  in and out may be the same buffer.
+void Filter::feed(const double *in, double *out, size_t n)
+{
+    if (symmetric && n > 0) {
+        work.resize(n + xlen - 1);
+        memcpy(&work[xlen - 1], in, sizeof(double) * n);
+        feedSymmetric(n, out);
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = step(in[i]);
+    }
+}
+
+void Filter::feed(const quint16 *in, double *out, size_t n)
+{
+    if (symmetric && n > 0) {
+        work.resize(n + xlen - 1);
+        for (size_t i = 0; i < n; i++) work[xlen - 1 + i] = in[i];
+        feedSymmetric(n, out);
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = step((double)in[i]);
+    }
+}
+
+double Filter::filterValue()
+{
+    return y[ypos];
+}
+
+// Private functions
+
+// Set up the normalised coefficients and the history rings
+void Filter::init()
+{
+    xlen = b.size();
+    ylen = a.size();
+
+    // Dividing through by a[0] here rather than on every sample gives the
+    // same doubles, so the output is unchanged
+    bn.resize(xlen);
+    an.resize(ylen);
+    for (qint32 i = 0; i < xlen; i++) bn[i] = b[i] / a[0];
+    for (qint32 i = 0; i < ylen; i++) an[i] = a[i] / a[0];
+
+    // Each history value is written at p and p + len, so the newest-first
+    // window starting at xpos (or ypos) is always contiguous and no memmove
+    // of the whole history is needed per sample
+    x.resize(xlen * 2);
+    y.resize(ylen * 2);
+
+    // Plain FIRs (a == {1.0}) with mirrored taps can use the folded kernels
+    hf.resize((xlen + 1) / 2);
+    symmetric = (!isIIR || ylen == 1) && fir_sym_fold(bn.data(), xlen, hf.data());
+
+    clear(0);
+}
+
+// Run the symmetric FIR kernel over work[], where the caller has already put
+// the n new samples at work[xlen - 1] onwards
+void Filter::feedSymmetric(size_t n, double *out)
+{
+    // Prepend the last xlen - 1 inputs, oldest first
+    for (qint32 k = 0; k < xlen - 1; k++) {
+        work[k] = x[xpos + xlen - 2 - k];
+    }
+
+    fir_symmetric(hf.data(), xlen, work.data(), out, n);
+
+    // Leave the history as if each sample had been fed through step()
+    xpos = 0;
+    for (qint32 k = 0; k < xlen; k++) {
+        x[k] = x[k + xlen] = work[n + xlen - 2 - k];
+    }
+    y[ypos] = y[ypos + ylen] = out[n - 1];
+}
+
+// Feed one sample through the filter.  The sums are accumulated in the same
+// order as the original memmove-based code, so results are bit-identical.
+inline double Filter::step(double val)
+{
+    double y0 = 0;
 
-    double *x_data = x.data();
-    double *y_data = y.data();
+    xpos = xpos ? (xpos - 1) : (xlen - 1);
+    x[xpos] = x[xpos + xlen] = val;
 
-    memmove(&x_data[1], x_data, sizeof(double) * (b.size() - 1));
-    if (isIIR) memmove(&y_data[1], y_data, sizeof(double) * (a.size() - 1));
+    const double *xp = &x[xpos];
+    const double *bp = bn.data();
 
-    x[0] = val;
-    y0 = 0; // ((b[0] / a0) * x[0]);
-    //cerr << "0 " << x[0] << ' ' << b[0] << ' ' << (b[0] * x[0]) << ' ' << y[0] << endl;
     if (isIIR) {
-        for (quint16 o = 0; o < b.size(); o++) {
-            y0 += ((b[o] / a0) * x[o]);
+        ypos = ypos ? (ypos - 1) : (ylen - 1);
+
+        const double *yp = &y[ypos];
+        const double *ap = an.data();
+
+        for (qint32 o = 0; o < xlen; o++) {
+            y0 += bp[o] * xp[o];
         }
-        for (quint16 o = 1; o < a.size(); o++) {
-            y0 -= ((a[o] / a0) * y[o]);
+        for (qint32 o = 1; o < ylen; o++) {
+            y0 -= ap[o] * yp[o];
         }
-//				for (int i = 0 ; i < b.size(); i++) cerr << 'b' << i << ' ' << b[i] << ' ' << x[i] << endl;
-//				for (int i = 0 ; i < a.size(); i++) cerr << 'a' << i << ' ' << a[i] << ' ' << y[i] << endl;
+
+        y[ypos] = y[ypos + ylen] = y0;
     } else {
         if (order == 13) {
             double t[4];
 
             // Cycling through destinations reduces pipeline stalls.
-            t[0] = b[0] * x[0];
-            t[1] = b[1] * x[1];
-            t[2] = b[2] * x[2];
-            t[3] = b[3] * x[3];
-            t[0] += b[4] * x[4];
-            t[1] += b[5] * x[5];
-            t[2] += b[6] * x[6];
-            t[3] += b[7] * x[7];
-            t[0] += b[8] * x[8];
-            t[1] += b[9] * x[9];
-            t[2] += b[10] * x[10];
-            t[3] += b[11] * x[11];
-            y0 = t[0] + t[1] + t[2] + t[3] + (b[12] * x[12]);
+            t[0] = bp[0] * xp[0];
+            t[1] = bp[1] * xp[1];
+            t[2] = bp[2] * xp[2];
+            t[3] = bp[3] * xp[3];
+            t[0] += bp[4] * xp[4];
+            t[1] += bp[5] * xp[5];
+            t[2] += bp[6] * xp[6];
+            t[3] += bp[7] * xp[7];
+            t[0] += bp[8] * xp[8];
+            t[1] += bp[9] * xp[9];
+            t[2] += bp[10] * xp[10];
+            t[3] += bp[11] * xp[11];
+            y0 = t[0] + t[1] + t[2] + t[3] + (bp[12] * xp[12]);
         } else for (int o = 0; o < order; o++) {
-            y0 += b[o] * x[o];
+            y0 += bp[o] * xp[o];
         }
-    }
 
-    y[0] = y0;
-    return y[0];
-}
+        y[0] = y0;
+    }
 
-double Filter::filterValue()
-{
-    return y[0];
+    return y0;
 }
@@ -5,6 +5,14 @@
 #include <QDebug>
 #include <vector>
 
+// Sample type for the resampled line buffers (see Tbc::scale).  Build with
+// CONFIG+=ld_float to use single precision; sample positions stay double.
+#ifdef LD_FLOAT
+typedef float sample_t;
+#else
+typedef double sample_t;
+#endif
+
 class Filter
 {
 public:
@@ -15,13 +23,29 @@ public:
     void clear(double val);
     void dump();
     double feed(double val);
+    void feed(const double *in, double *out, size_t n);
+    void feed(const quint16 *in, double *out, size_t n);
     double filterValue();
 
 protected:
     int order;
     bool isIIR;
     std::vector<double> a, b;
+    std::vector<double> bn, an; // b and a pre-divided by a[0]
+
+    // History rings (each value is stored twice, see filter.cpp)
     std::vector<double> y, x;
+    qint32 xlen, ylen;
+    qint32 xpos, ypos;
+
+    // Folded taps for symmetric FIRs, and the scratch buffer for block feeds
+    // through the SIMD kernels (see fir-simd.h)
+    bool symmetric;
+    std::vector<double> hf, work;
+
+    void init();
+    inline double step(double val);
+    void feedSymmetric(size_t n, double *out);
 };
 
 #endif // FILTER_H
@@ -167,6 +167,63 @@ int main(int argc, char *argv[])
                 QCoreApplication::translate("main", "0.0-1000.0"));
     parser.addOption(rotOption);
 
+    // Option to set the number of threads used for resampling (-t)
+    QCommandLineOption threadsOption(QStringList() << "t" << "threads",
+                QCoreApplication::translate("main", "Specify the number of threads to resample fields with - default 1"),
+                QCoreApplication::translate("main", "1-64"));
+    parser.addOption(threadsOption);
+
+    // Options to set the number of burst phase alignment passes and their tolerance
+    QCommandLineOption burstPassesOption(QStringList() << "burst-passes",
+                QCoreApplication::translate("main", "Specify the maximum number of burst phase alignment passes per field - default 2"),
+                QCoreApplication::translate("main", "1-16"));
+    parser.addOption(burstPassesOption);
+
+    QCommandLineOption burstToleranceOption(QStringList() << "burst-tolerance",
+                QCoreApplication::translate("main", "Specify the burst phase alignment tolerance in subcarrier cycles - default 0.005"),
+                QCoreApplication::translate("main", "0.0-0.25"));
+    parser.addOption(burstToleranceOption);
+
+    // Option to set the number of phases in the line resampler's table
+    QCommandLineOption resamplerPhasesOption(QStringList() << "resample-phases",
+                QCoreApplication::translate("main", "Specify the number of fractional phases used to resample lines (0 = exact cubic) - default 256"),
+                QCoreApplication::translate("main", "0-4096"));
+    parser.addOption(resamplerPhasesOption);
+
+    // Options to start processing part way into the input video file
+    QCommandLineOption skipFramesOption(QStringList() << "skip-frames",
+                QCoreApplication::translate("main", "Specify the number of frames to skip at the start of the input"),
+                QCoreApplication::translate("main", "frames"));
+    parser.addOption(skipFramesOption);
+
+    QCommandLineOption seekPictureOption(QStringList() << "seek-picture",
+                QCoreApplication::translate("main", "Start from the frame with the specified CAV picture number (input file only)"),
+                QCoreApplication::translate("main", "picture"));
+    parser.addOption(seekPictureOption);
+
+    // Options to split one input across several runs (shards) and put the results back together
+    QCommandLineOption inputRangeOption(QStringList() << "input-range",
+                QCoreApplication::translate("main", "Only output the frames starting in this byte range of the input file (end may be left out, video only)"),
+                QCoreApplication::translate("main", "start:end"));
+    parser.addOption(inputRangeOption);
+
+    QCommandLineOption stitchOption(QStringList() << "stitch",
+                QCoreApplication::translate("main", "Concatenate the --input-range outputs given as arguments (in input order) into the output video file"));
+    parser.addOption(stitchOption);
+    parser.addPositionalArgument("shards", QCoreApplication::translate("main", "Shard video files to stitch (with --stitch)"), "[shards...]");
+
+    // Option to write the syncs found to a sync index file
+    QCommandLineOption targetSyncIndexFileOption(QStringList() << "write-index",
+                QCoreApplication::translate("main", "Write the frame syncs found to a sync index file"),
+                QCoreApplication::translate("main", "file"));
+    parser.addOption(targetSyncIndexFileOption);
+
+    // Option to resample using a sync index file rather than finding the syncs
+    QCommandLineOption sourceSyncIndexFileOption(QStringList() << "read-index",
+                QCoreApplication::translate("main", "Resample using the frame syncs from a sync index file (no audio output)"),
+                QCoreApplication::translate("main", "file"));
+    parser.addOption(sourceSyncIndexFileOption);
+
     // Process the command line arguments given by the user
     parser.process(app);
 
@@ -194,11 +251,36 @@ int main(int argc, char *argv[])
     QString sourceAudioFileParameter = parser.value(sourceAudioFileOption);
     QString targetVideoFileParameter = parser.value(targetVideoFileOption);
     QString targetAudioFileParameter = parser.value(targetAudioFileOption);
+    QString targetSyncIndexFileParameter = parser.value(targetSyncIndexFileOption);
+    QString sourceSyncIndexFileParameter = parser.value(sourceSyncIndexFileOption);
 
     // Numerical parameter options
     bool rot = parser.isSet(rotOption);
     QString rotParameter = parser.value(rotOption);
     double_t rotParameterValue = 0;
+    bool threads = parser.isSet(threadsOption);
+    QString threadsParameter = parser.value(threadsOption);
+    qint32 threadsParameterValue = 1;
+    bool burstPasses = parser.isSet(burstPassesOption);
+    QString burstPassesParameter = parser.value(burstPassesOption);
+    qint32 burstPassesParameterValue = 2;
+    bool burstTolerance = parser.isSet(burstToleranceOption);
+    QString burstToleranceParameter = parser.value(burstToleranceOption);
+    double_t burstToleranceParameterValue = 0.005;
+    bool resamplerPhases = parser.isSet(resamplerPhasesOption);
+    QString resamplerPhasesParameter = parser.value(resamplerPhasesOption);
+    qint32 resamplerPhasesParameterValue = 256;
+    bool skipFrames = parser.isSet(skipFramesOption);
+    QString skipFramesParameter = parser.value(skipFramesOption);
+    qint32 skipFramesParameterValue = 0;
+    bool seekPicture = parser.isSet(seekPictureOption);
+    QString seekPictureParameter = parser.value(seekPictureOption);
+    qint32 seekPictureParameterValue = -1;
+    bool inputRange = parser.isSet(inputRangeOption);
+    QString inputRangeParameter = parser.value(inputRangeOption);
+    qint64 inputRangeStartValue = 0;
+    qint64 inputRangeEndValue = -1;
+    bool stitch = parser.isSet(stitchOption);
 
     // Verify the command line arguments
     bool commandLineOptionsOk = true;
@@ -219,6 +301,114 @@ int main(int argc, char *argv[])
         }
     }
 
+    // If the threads option is used verify the parameter
+    if (threads) {
+        bool conversionOk;
+        threadsParameterValue = threadsParameter.toInt(&conversionOk);
+
+        if (!conversionOk || (threadsParameterValue < 1) || (threadsParameterValue > 64)) {
+            qCritical("The threads parameter specified with -t must be in the range of 1-64");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    // If the burst alignment options are used verify the parameters
+    if (burstPasses) {
+        bool conversionOk;
+        burstPassesParameterValue = burstPassesParameter.toInt(&conversionOk);
+
+        if (!conversionOk || (burstPassesParameterValue < 1) || (burstPassesParameterValue > 16)) {
+            qCritical("The burst-passes parameter must be in the range of 1-16");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    if (burstTolerance) {
+        bool conversionOk;
+        burstToleranceParameterValue = burstToleranceParameter.toDouble(&conversionOk);
+
+        if (!conversionOk || (burstToleranceParameterValue < 0.0) || (burstToleranceParameterValue > 0.25)) {
+            qCritical("The burst-tolerance parameter must be in the range of 0.0-0.25");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    // If the resampler phases option is used verify the parameter
+    if (resamplerPhases) {
+        bool conversionOk;
+        resamplerPhasesParameterValue = resamplerPhasesParameter.toInt(&conversionOk);
+
+        if (!conversionOk || (resamplerPhasesParameterValue < 0) || (resamplerPhasesParameterValue > 4096)) {
+            qCritical("The resample-phases parameter must be in the range of 0-4096");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    // If the seek options are used verify the parameters
+    if (skipFrames) {
+        bool conversionOk;
+        skipFramesParameterValue = skipFramesParameter.toInt(&conversionOk);
+
+        if (!conversionOk || (skipFramesParameterValue < 0)) {
+            qCritical("The skip-frames parameter must be a positive number of frames");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    if (seekPicture) {
+        bool conversionOk;
+        seekPictureParameterValue = seekPictureParameter.toInt(&conversionOk);
+
+        if (!conversionOk || (seekPictureParameterValue < 1) || (seekPictureParameterValue > 79999)) {
+            qCritical("The seek-picture parameter must be in the range of 1-79999");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    // If the input range option is used verify the parameter
+    if (inputRange) {
+        QStringList rangeParameters = inputRangeParameter.split(':');
+        bool conversionOk = (rangeParameters.size() == 2);
+
+        if (conversionOk) inputRangeStartValue = rangeParameters[0].toLongLong(&conversionOk);
+        if (conversionOk && !rangeParameters[1].isEmpty()) inputRangeEndValue = rangeParameters[1].toLongLong(&conversionOk);
+
+        if (!conversionOk || (inputRangeStartValue < 0) || ((inputRangeEndValue >= 0) && (inputRangeEndValue <= inputRangeStartValue))) {
+            qCritical("The input-range parameter must be start:end (in bytes) with end after start");
+            commandLineOptionsOk = false;
+        }
+
+        if (skipFrames || seekPicture) {
+            qCritical("The input-range option cannot be used with skip-frames or seek-picture");
+            commandLineOptionsOk = false;
+        }
+
+        // Only the video of the shards is stitched, so audio needs its own pass over the whole input
+        if (parser.isSet(sourceAudioFileOption) || parser.isSet(targetAudioFileOption)) {
+            qCritical("The input-range option cannot be used with audio input or output files");
+            commandLineOptionsOk = false;
+        }
+    }
+
+    // The legacy PAL TBC only supports the original options (and resample-phases)
+    if (palLegacy && (threads || burstPasses || burstTolerance || skipFrames || seekPicture || inputRange || stitch ||
+                      parser.isSet(targetSyncIndexFileOption) || parser.isSet(sourceSyncIndexFileOption))) {
+        qCritical("The legacy PAL mode (-l) cannot be used with threads, burst-passes, burst-tolerance, skip-frames, "
+                  "seek-picture, input-range, stitch, write-index or read-index");
+        commandLineOptionsOk = false;
+    }
+
+    if (stitch && parser.positionalArguments().isEmpty()) {
+        qCritical("The stitch option needs the shard video files to stitch");
+        commandLineOptionsOk = false;
+    }
+
+    // A sync index can't be read and written in the same run
+    if (parser.isSet(targetSyncIndexFileOption) && parser.isSet(sourceSyncIndexFileOption)) {
+        qCritical("The write-index and read-index options cannot be used together");
+        commandLineOptionsOk = false;
+    }
+
     // TO-DO:  You can only specifiy an audio file if a video file is also specified...
     // add in some code to check for this error condition and warn the user correctly.
 
@@ -238,6 +428,7 @@ int main(int argc, char *argv[])
             if (parser.isSet(audioOnlyOption)) tbcPal.setAudioOnly(audioOnly);
             if (parser.isSet(performFreezeFrameOption)) tbcPal.setPerformFreezeFrame(performFreezeFrame);
             if (parser.isSet(rotOption)) tbcPal.setRot(rotParameterValue);
+            if (parser.isSet(resamplerPhasesOption)) tbcPal.setResamplerPhases(resamplerPhasesParameterValue);
 
             // Apply the mandatory command line parameters to the PAL TBC object
             tbcPal.setSourceVideoFile(sourceVideoFileParameter);
@@ -260,6 +451,15 @@ int main(int argc, char *argv[])
             if (parser.isSet(audioOnlyOption)) tbcNtsc.setAudioOutputOnly(audioOnly);
             if (parser.isSet(performFreezeFrameOption)) tbcNtsc.setPerformFreezeFrame(performFreezeFrame);
             if (parser.isSet(rotOption)) tbcNtsc.setRotDetectLevel(rotParameterValue);
+            if (parser.isSet(threadsOption)) tbcNtsc.setThreads(threadsParameterValue);
+            if (parser.isSet(burstPassesOption)) tbcNtsc.setBurstPhasePasses(burstPassesParameterValue);
+            if (parser.isSet(burstToleranceOption)) tbcNtsc.setBurstPhaseTolerance(burstToleranceParameterValue);
+            if (parser.isSet(resamplerPhasesOption)) tbcNtsc.setResamplerPhases(resamplerPhasesParameterValue);
+            if (parser.isSet(skipFramesOption)) tbcNtsc.setSkipFrames(skipFramesParameterValue);
+            if (parser.isSet(seekPictureOption)) tbcNtsc.setSeekPicture(seekPictureParameterValue);
+            if (parser.isSet(inputRangeOption)) tbcNtsc.setInputRange(inputRangeStartValue, inputRangeEndValue);
+            if (parser.isSet(targetSyncIndexFileOption)) tbcNtsc.setTargetSyncIndexFile(targetSyncIndexFileParameter);
+            if (parser.isSet(sourceSyncIndexFileOption)) tbcNtsc.setSourceSyncIndexFile(sourceSyncIndexFileParameter);
 
             // Apply the mandatory command line parameters to the NTSC TBC object
             tbcNtsc.setSourceVideoFile(sourceVideoFileParameter);
@@ -267,8 +467,9 @@ int main(int argc, char *argv[])
             tbcNtsc.setTargetVideoFile(targetVideoFileParameter);
             tbcNtsc.setTargetAudioFile(targetAudioFileParameter);
 
-            // Execute NTSC TBC
-            tbcNtsc.execute();
+            // Execute NTSC TBC (or stitch shards it has already processed)
+            if (stitch) tbcNtsc.stitchShards(parser.positionalArguments());
+            else tbcNtsc.execute();
         }
 
     } else {
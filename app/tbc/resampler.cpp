@@ -0,0 +1,102 @@
+/************************************************************************
+
+    resampler.cpp
+
+    Time-Based Correction
+    ld-decode - Software decode of Laserdiscs from raw RF
+    Copyright (C) 2018 Chad Page
+    Copyright (C) 2018 Simon Inns
+
+    This file is part of ld-decode.
+
+    ld-decode is free software: you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#include "resampler.h"
+
+// Public functions
+Resampler::Resampler(qint32 _phases)
+{
+    phases = (_phases > 0) ? _phases : 0;
+
+    // Weights of y[-1], y[0], y[1] and y[2] in the cubic used by the old
+    // cubicInterpolate(), expanded out for each phase x
+    coefficients.resize((phases + 1) * 4);
+    for (qint32 phase = 0; phase <= phases && phases > 0; phase++) {
+        double x = (double)phase / phases;
+        double x2 = x * x, x3 = x2 * x;
+
+        coefficients[(phase * 4) + 0] = 0.5 * (-x + (2.0 * x2) - x3);
+        coefficients[(phase * 4) + 1] = 1.0 + (0.5 * ((-5.0 * x2) + (3.0 * x3)));
+        coefficients[(phase * 4) + 2] = 0.5 * (x + (4.0 * x2) - (3.0 * x3));
+        coefficients[(phase * 4) + 3] = 0.5 * (-x2 + x3);
+    }
+}
+
+void Resampler::resample(const quint16 *in, double *out, double start, double step, qint32 count) const
+{
+    resampleLine(in, out, start, step, count);
+}
+
+void Resampler::resample(const quint16 *in, float *out, double start, double step, qint32 count) const
+{
+    resampleLine(in, out, start, step, count);
+}
+
+qint32 Resampler::getPhases(void) const
+{
+    return phases;
+}
+
+// Private functions
+
+// Note: the position is accumulated exactly as the old scale() loops did it
+// (p1 += step), so the table and exact paths sample the same points
+template <typename T>
+void Resampler::resampleLine(const quint16 *in, T *out, double start, double step, qint32 count) const
+{
+    double p1 = start;
+
+    for (qint32 i = 0; i < count; i++) {
+        qint32 index = (qint32)p1;
+        double v;
+
+        // Positions before sample 1 are clamped to it, which makes x negative - those
+        // (and the exact mode) use the polynomial directly
+        if ((phases > 0) && (index >= 1)) {
+            const quint16 *y = &in[index - 1];
+            const double *c = &coefficients[(qint32)(((p1 - index) * phases) + 0.5) * 4];
+
+            v = (c[0] * y[0]) + (c[1] * y[1]) + (c[2] * y[2]) + (c[3] * y[3]);
+        } else {
+            if (index < 1) index = 1;
+
+            const quint16 *y = &in[index - 1];
+            double x = p1 - index;
+            double p[4];
+            p[0] = y[0]; p[1] = y[1]; p[2] = y[2]; p[3] = y[3];
+
+            v = p[1] + 0.5 * x*(p[2] - p[0] + x*(2.0*p[0] - 5.0*p[1] + 4.0*p[2] - p[3] + x*(3.0*(p[1] - p[2]) + p[3] - p[0])));
+        }
+
+        if (v < 0) v = 0;
+        if (v > 65535) v = 65535;
+        out[i] = v;
+
+        p1 += step;
+    }
+}
@@ -0,0 +1,67 @@
+/************************************************************************
+
+    resampler.h
+
+    Time-Based Correction
+    ld-decode - Software decode of Laserdiscs from raw RF
+    Copyright (C) 2018 Chad Page
+    Copyright (C) 2018 Simon Inns
+
+    This file is part of ld-decode.
+
+    ld-decode is free software: you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <QCoreApplication>
+#include <QVector>
+
+// Line resampler for Tbc::scale() and TbcPal::scale().
+//
+// This is the same cubic (Catmull-Rom) interpolation the TBCs always used, but
+// with the four tap weights looked up from a table of fractional phases rather
+// than evaluating the polynomial for every output sample - each output is then
+// just a 4-tap dot product of neighbouring input samples.  More phases means a
+// closer match to the exact cubic; with 256 phases the sample position is
+// quantised to 1/512 of an input sample.  Zero phases selects the exact
+// polynomial (the old behaviour).
+//
+// The table is only written by the constructor, so one Resampler can be shared
+// by several resampling threads.
+class Resampler
+{
+public:
+    Resampler(qint32 _phases);
+
+    // Write count samples to out, starting at input position start and stepping by step.
+    // Results are clamped to 0-65535
+    void resample(const quint16 *in, double *out, double start, double step, qint32 count) const;
+    void resample(const quint16 *in, float *out, double start, double step, qint32 count) const;
+
+    qint32 getPhases(void) const;
+
+private:
+    qint32 phases;
+    QVector<double> coefficients; // 4 per phase, phases + 1 phases (so x == 1.0 has an entry)
+
+    template <typename T>
+    void resampleLine(const quint16 *in, T *out, double start, double step, qint32 count) const;
+};
+
+#endif // RESAMPLER_H
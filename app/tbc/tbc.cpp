@@ -102,6 +102,8 @@ Tbc::Tbc()
     setSourceAudioFile(""); // Default is empty
     setTargetVideoFile(""); // Default is empty
     setTargetAudioFile(""); // Default is empty
+    setSourceSyncIndexFile(""); // Default is empty
+    setTargetSyncIndexFile(""); // Default is empty
 
     setMagneticVideoMode(false);
     setFlipFields(false);
@@ -110,6 +112,14 @@ Tbc::Tbc()
     setRotDetectLevel(40.0);
     setSkipFrames(0);
     setMaximumFrames(0);
+    setSeekPicture(-1); // Default is no seek
+    setInputRange(0, -1); // Default is the whole input
+    setThreads(1);
+    setBurstPhasePasses(2);
+    setBurstPhaseTolerance(0.005);
+    burstPhaseStats = BurstPhaseStats();
+    resampler = NULL;
+    setResamplerPhases(256);
 
     // Note: the following settings are always false as they
     // point to stale code
@@ -124,8 +134,6 @@ Tbc::Tbc()
     processAudioState.prev_time = -1;
     processAudioState.nextAudioSample = 0;
     processAudioState.prev_loc = -1;
-    processAudioState.prev_index = 0;
-    processAudioState.prev_i = 0;
     processAudioState.firstloc = -1;
 
     processAudioState.a_read = 0;
@@ -135,7 +143,6 @@ Tbc::Tbc()
     // Globals for processAudioSample()
     processAudioState.audioChannelOneFilter = new Filter(f_fmdeemp);
     processAudioState.audioChannelTwoFilter = new Filter(f_fmdeemp);
-    processAudioState.audioOutputBufferPointer = 0;
 
     // Globals to do with the line processing functions
     processLineState.frameno = -1;
@@ -145,6 +152,14 @@ Tbc::Tbc()
     autoRangeState.high = 0;
     autoRangeState.inputMaximumIreLevel = 327.68;
     autoRangeState.inputMinimumIreLevel = (autoRangeState.inputMaximumIreLevel * 20);	// IRE == -40
+    autoRangeState.filteredTo = 0;
+    autoRangeState.filteredFrom = 0;
+}
+
+// Class destructor function
+Tbc::~Tbc()
+{
+    delete resampler;
 }
 
 // TODO: Split the file handling logic from the processing logic; this function is too
@@ -176,12 +191,26 @@ qint32 Tbc::execute(void)
     qInfo() << "  Laser-rot detection level =" << (double)tbcConfiguration.rotDetectLevel;
     qInfo() << "  Skip frames =" << (double)tbcConfiguration.skipFrames;
     qInfo() << "  Maximum frames =" << (double)tbcConfiguration.maximumFrames;
+    qInfo() << "  Seek to picture =" << tbcConfiguration.seekPicture;
+    qInfo() << "  Input range =" << tbcConfiguration.inputRangeStart << "to" << tbcConfiguration.inputRangeEnd;
+    qInfo() << "  Threads =" << tbcConfiguration.threads;
+    qInfo() << "  Burst phase passes =" << tbcConfiguration.burstPhasePasses;
+    qInfo() << "  Burst phase tolerance =" << (double)tbcConfiguration.burstPhaseTolerance;
+    qInfo() << "  Resampler phases =" << tbcConfiguration.resamplerPhases;
+    qInfo() << "  Read sync index from =" << tbcConfiguration.sourceSyncIndexFileName;
+    qInfo() << "  Write sync index to =" << tbcConfiguration.targetSyncIndexFileName;
     qInfo() << "";
 
+#ifndef QT_NO_DEBUG
+    // Debug builds check that the burst phase fit works at this input frequency
+    // (it only warns - the alignment passes will reject lines if it doesn't)
+    if (!checkBurstPhaseDFT()) qWarning() << "Burst phase estimator self-check failed";
+#endif
+
     // Define our video and audio input buffers
     QVector<quint16> videoInputBuffer;
     QVector<QVector<quint16 > > videoOutputBuffer; // A Vector of 505 Vectors * 844 pixels
-    QVector<double_t> audioInputBuffer;
+    AudioInputRing audioInputRing;
 
     // Define out video and audio output buffers
     QVector<quint16> audioOutputBuffer;
@@ -194,7 +223,6 @@ qint32 Tbc::execute(void)
 
     // Define the required number of elements in the video and audio buffers
     qint32 videoInputBufferNumberOfElements;
-    qint32 audioInputBufferNumberOfElements;
     qint32 audioOuputBufferNumberOfElements;
     qint32 videoOutputBufferNumberOfLines;
     qint32 videoOutputBufferNumberOfSamples;
@@ -206,7 +234,6 @@ qint32 Tbc::execute(void)
         // NTSC cxadc is 910 input samples per line, 910 * 1100 = 1,001,000 / 16 = 62562.5 (i.e. not divisible by 16...)
         // So... what we are really doing is setting our buffer length to approximately 1100 lines of video, or about 2 frames of NTSC
         videoInputBufferNumberOfElements = ((qint64)tbcConfiguration.inputSamplesPerVideoLine * 1100);
-        audioInputBufferNumberOfElements = ((qint64)tbcConfiguration.inputSamplesPerVideoLine * 1100) / 40;
         audioOuputBufferNumberOfElements = 512; // Fixed length
         videoOutputBufferNumberOfLines = tbcConfiguration.numberOfVideoLinesPerFrame; // This is set to 505 lines for NTSC
 
@@ -216,7 +243,6 @@ qint32 Tbc::execute(void)
     } else {
         // PAL configuration - DOES NOT WORK AT ALL
         videoInputBufferNumberOfElements = ((qint64)tbcConfiguration.inputSamplesPerVideoLine * 1100);
-        audioInputBufferNumberOfElements = ((qint64)tbcConfiguration.inputSamplesPerVideoLine * 1100) / 40;
         audioOuputBufferNumberOfElements = 512; // Fixed length
         videoOutputBufferNumberOfLines = tbcConfiguration.numberOfVideoLinesPerFrame; // The display is 610 lines for PAL
         videoOutputBufferNumberOfSamples = (tbcConfiguration.videoOutputFrequencyInFsc * 211);
@@ -224,8 +250,12 @@ qint32 Tbc::execute(void)
 
     // Ensure that our buffer vectors are the correct length
     videoInputBuffer.resize(videoInputBufferNumberOfElements);
-    audioInputBuffer.resize(audioInputBufferNumberOfElements);
-    audioOutputBuffer.resize(audioOuputBufferNumberOfElements);
+    audioOutputBuffer.reserve(audioOuputBufferNumberOfElements * 2);
+
+    // The audio input ring holds the audio for a whole video input buffer (with a line to spare at each end)
+    initAudioInputRing(audioInputRing,
+                       ((videoInputBufferNumberOfElements + (2 * tbcConfiguration.inputSamplesPerVideoLine)) /
+                        processAudioState.va_ratio) + 1, 0);
 
     videoOutputBuffer.resize(videoOutputBufferNumberOfLines);
     // As this is a vector of vectors, we have to resize each vector individually
@@ -345,19 +375,149 @@ qint32 Tbc::execute(void)
         qInfo() << "Writing video data to" << tbcConfiguration.targetVideoFileName;
     }
 
+    // Replaying a sync index written by an earlier run?  Then there's no sync
+    // detection to do and the input is just resampled frame by frame
+    if (!tbcConfiguration.sourceSyncIndexFileName.isEmpty()) {
+        if (processAudioData) qWarning() << "Audio is not processed when reading a sync index";
+
+        qint32 result = resampleFromSyncIndex(videoInputFileHandle, videoOutputFileHandle);
+
+        if (videoInputFileHandle->isOpen()) videoInputFileHandle->close();
+        if (videoOutputFileHandle->isOpen()) videoOutputFileHandle->close();
+        if ((audioInputFileHandle != NULL) && audioInputFileHandle->isOpen()) audioInputFileHandle->close();
+        if ((audioOutputFileHandle != NULL) && audioOutputFileHandle->isOpen()) audioOutputFileHandle->close();
+
+        if (result == 0) qInfo() << "Processing complete";
+        return result;
+    }
+
+    // Open the sync index output file (if required)
+    QFile *syncIndexFileHandle = NULL;
+    QDataStream syncIndex;
+
+    if (!tbcConfiguration.targetSyncIndexFileName.isEmpty()) {
+        syncIndexFileHandle = new QFile(tbcConfiguration.targetSyncIndexFileName);
+        if (!syncIndexFileHandle->open(QIODevice::WriteOnly)) {
+            // Failed to open sync index file
+            qWarning() << "Could not open specified sync index output file";
+            return -1;
+        }
+        syncIndex.setDevice(syncIndexFileHandle);
+        writeSyncIndexHeader(syncIndex);
+        qInfo() << "Writing sync index to" << tbcConfiguration.targetSyncIndexFileName;
+    }
 
     // Perform the input video and audio file processing --------------------------------------------
-    size_t numberOfAudioBufferElementsProcessed = 0;
 
     // Buffer tracking variables
     qint32 videoElementsInBuffer = 0;
-    qint32 audioElementsInBuffer = 0;
 
     // Get the input video file size (for progress reporting)
     qint64 inputFileSize = videoInputFileHandle->bytesAvailable();
 
     // File tracking variables
     qint64 receivedVideoBytes = 0;
+    bool videoInputAtEnd = false;
+
+    // A video input file is memory-mapped as a whole, and each pass just points
+    // processVideoAndAudioBuffer() at the next window of it - consuming data only moves
+    // videoInputPosition along, rather than shifting the buffer back and reading again.
+    // stdin goes through videoInputBuffer as before, and so does the last (partial)
+    // window of a file as that has to be padded out to the full buffer size
+    quint16 *videoInputMap = NULL;
+    qint64 videoInputMapElements = 0;
+    qint64 videoInputPosition = 0;
+    bool useVideoInputMap = false;
+
+    if (!tbcConfiguration.sourceVideoFileName.isEmpty()) {
+        videoInputMap = reinterpret_cast<quint16 *>(videoInputFileHandle->map(0, inputFileSize));
+
+        if (videoInputMap != NULL) {
+            videoInputMapElements = inputFileSize / sizeof(quint16);
+            useVideoInputMap = true;
+        } else qDebug() << "Could not memory-map the video input file, using buffered reads";
+    }
+
+    // With an input range (setInputRange()) only the frames starting in the range are
+    // output.  The range is widened by half a frame at each end, so the frame at a
+    // shard boundary is in both shards rather than neither (stitchShards() drops the
+    // second copy)
+    bool useInputRange = (tbcConfiguration.inputRangeStart > 0) || (tbcConfiguration.inputRangeEnd >= 0);
+    bool reachedInputRangeEnd = false;
+    bool frameInInputRange = !useInputRange;
+    qint64 inputRangeStart = 0;
+    qint64 inputRangeEnd = 0;
+    qint64 samplesPerFrame = tbcConfiguration.videoInputFrequencyInFsc * tbcConfiguration.dotsPerVideoLine *
+            (tbcConfiguration.isNtsc ? 525 : 625);
+
+    if (useInputRange) {
+        if (tbcConfiguration.sourceVideoFileName.isEmpty()) {
+            qWarning() << "An input range can only be used with a video input file (not stdin)";
+            return -1;
+        }
+
+        // Shards overlap by a frame at each end and only their video is stitched back
+        // together, so audio has to be done in a separate pass over the whole input
+        if (processAudioData) {
+            qWarning() << "An input range cannot be used with audio processing";
+            return -1;
+        }
+
+        inputRangeStart = (tbcConfiguration.inputRangeStart / (qint64)sizeof(quint16)) - (samplesPerFrame / 2);
+        inputRangeEnd = (tbcConfiguration.inputRangeEnd >= 0) ?
+                    (tbcConfiguration.inputRangeEnd / (qint64)sizeof(quint16)) + (samplesPerFrame / 2) :
+                    (inputFileSize / (qint64)sizeof(quint16)) + (samplesPerFrame / 2);
+    }
+
+    // Skipping frames (or seeking to a picture number or the start of the input range)
+    // in a file goes straight to the estimated position rather than sync-scanning
+    // everything before it.  stdin can't seek, so there processVideoAndAudioBuffer()
+    // still skips frame by frame
+    if (!tbcConfiguration.sourceVideoFileName.isEmpty() &&
+            ((tbcConfiguration.skipFrames > 0) || (tbcConfiguration.seekPicture >= 0) || (inputRangeStart > 0))) {
+        // An input range starts 4 frames early, so that the AGC, the audio filters and
+        // the hsync tracking have settled by the first frame that's output
+        qint64 startPosition = (inputRangeStart > 0) ? qMax((qint64)0, inputRangeStart - (4 * samplesPerFrame)) :
+                    findSeekPosition(videoInputFileHandle, videoInputMap, inputFileSize / sizeof(quint16),
+                                     videoInputBufferNumberOfElements);
+        qInfo() << "Starting at input position" << startPosition;
+
+        videoInputPosition = startPosition;
+        if (!useVideoInputMap) videoInputFileHandle->seek(startPosition * sizeof(quint16));
+
+        // Keep the audio in step with the video
+        processAudioState.v_read = startPosition;
+        processAudioState.a_read = startPosition / processAudioState.va_ratio;
+        // (an audio sample is a left/right pair of doubles)
+        if (processAudioData && !audioInputFileHandle->seek(processAudioState.a_read * 2 * sizeof(double_t))) {
+            qCritical() << "Could not seek to audio sample" << processAudioState.a_read << "in the audio input file - aborting";
+            return -1;
+        }
+        audioInputRing.startPosition = audioInputRing.endPosition = processAudioState.a_read;
+
+        // Auto-ranging starts (and lets its filter settle) from here
+        autoRangeState.filteredFrom = startPosition;
+        autoRangeState.filteredTo = startPosition;
+
+        // The frames have been skipped already
+        processLineState.frameno = tbcConfiguration.skipFrames;
+
+        // Only count the burst phase alignment of the fields that are processed (not the seek's probes)
+        burstPhaseStats = BurstPhaseStats();
+    }
+
+    // With more than one thread, processVideoAndAudioBuffer() only does the sync
+    // pass and each frame's resampling is handed to the global thread pool.
+    // Frames are written in the order they were queued.  (Auto-ranging changes
+    // the input levels between buffers, so it stays inline.)
+    bool resampleInThreads = (tbcConfiguration.threads > 1) && !tbcConfiguration.performAutoRanging;
+    QQueue<QFuture<QVector<QVector<quint16> > > > pendingFrames;
+
+    if (resampleInThreads) QThreadPool::globalInstance()->setMaxThreadCount(tbcConfiguration.threads);
+
+    // The frame syncs are needed outside of processVideoAndAudioBuffer() when
+    // resampling in threads or when writing them to the sync index
+    bool collectSyncs = resampleInThreads || (syncIndexFileHandle != NULL) || useInputRange;
 
     do {
         qDebug() << "Beginning video TBC processing loop with videoElementsInBuffer =" <<
@@ -365,13 +525,34 @@ qint32 Tbc::execute(void)
 
         // Calculate processing progress in % (cannot do this for stdin...)
         if (!tbcConfiguration.sourceVideoFileName.isEmpty()) {
-            double_t percentDone = 100.0 - (100.0 / (double_t)inputFileSize) *
-                    (double_t)videoInputFileHandle->bytesAvailable();
+            qint64 bytesRemaining = useVideoInputMap ? inputFileSize - (videoInputPosition * (qint64)sizeof(quint16)) :
+                                                       videoInputFileHandle->bytesAvailable();
+            double_t percentDone = 100.0 - (100.0 / (double_t)inputFileSize) * (double_t)bytesRemaining;
             qInfo() << (qint32)percentDone << "% of input file processed";
         }
 
+        // Once there's less than a whole buffer left in the mapped file, carry on with
+        // buffered reads from the current position
+        if (useVideoInputMap && ((videoInputPosition + videoInputBufferNumberOfElements) > videoInputMapElements)) {
+            qDebug() << "Reached the end of the mapped video input, switching to buffered reads";
+            videoInputFileHandle->seek(videoInputPosition * sizeof(quint16));
+            videoElementsInBuffer = 0;
+            useVideoInputMap = false;
+        }
+
+        quint16 *videoInput;
+
+        if (useVideoInputMap) {
+            videoInput = videoInputMap + videoInputPosition;
+            videoElementsInBuffer = videoInputBufferNumberOfElements;
+            receivedVideoBytes = (qint64)videoElementsInBuffer * sizeof(quint16);
+            videoInputAtEnd = ((videoInputPosition + videoInputBufferNumberOfElements) >= videoInputMapElements);
+        } else {
+            videoInput = videoInputBuffer.data();
+        }
+
         // Fill the video buffer from the video input file
-        while ((videoElementsInBuffer < videoInputBuffer.size()) && (!videoInputFileHandle->atEnd())) {
+        while ((!useVideoInputMap) && (videoElementsInBuffer < videoInputBuffer.size()) && (!videoInputFileHandle->atEnd())) {
             qDebug() << "Requesting" << (videoInputBuffer.size() - videoElementsInBuffer) <<
                         "elements from video file to fill video buffer";
 
@@ -393,30 +574,19 @@ qint32 Tbc::execute(void)
             // Add the received elements count to the video elements in buffer count
             videoElementsInBuffer += (qint32)(receivedVideoBytes / sizeof(quint16));
         }
+        if (!useVideoInputMap) videoInputAtEnd = videoInputFileHandle->atEnd();
 
         // Are we processing audio data?
         if (processAudioData) {
-            qDebug() << "Requesting" << (audioInputBuffer.size() - audioElementsInBuffer) <<
-                        "elements from audio file to fill audio buffer";
+            // Top up the audio input ring (the audio from before the video buffer is no longer needed)
+            qint64 receivedAudioSamples = fillAudioInputRing(audioInputFileHandle, audioInputRing, processAudioState.a_read);
 
-            // Read from the audio input file and store in the audio buffer vector
-            // This operation uses bytes, so we multiply the elements by the size of the data-type
-            qint64 receivedAudioBytes =
-                    audioInputFileHandle->read(reinterpret_cast<char *>(audioInputBuffer.data()) +
-                                               (audioElementsInBuffer * sizeof(double_t)),
-                                               ((audioInputBuffer.size() - audioElementsInBuffer) * sizeof(double_t)));
-
-            // If received bytes is -1, the readRawData operation failed for some unknown reason
-            // If received bytes is 0, it's probably because we are reading from stdin with nothing avaiable
-            if (receivedAudioBytes < 0) {
-                qCritical() << "readRawData() operation on audio input file returned error - aborting";
+            // If received samples is -1, the read operation failed for some unknown reason
+            if (receivedAudioSamples < 0) {
+                qCritical() << "read() operation on audio input file returned error - aborting";
                 return -1;
             }
-            qDebug() << "Received" << (receivedAudioBytes / sizeof(double_t)) << "elements (" <<
-                        receivedAudioBytes << "bytes ) from file read operation";
-
-            // Add the received elements count to the video elements in buffer count
-            audioElementsInBuffer += (qint32)(receivedAudioBytes / sizeof(double_t));
+            qDebug() << "Received" << receivedAudioSamples << "audio samples from file read operation";
         }
 
         // Only perform processing if there's something to process
@@ -425,7 +595,7 @@ qint32 Tbc::execute(void)
             if (tbcConfiguration.performAutoRanging) {
                 // Perform auto range of input video data
                 qDebug() << "Performing auto ranging...";
-                autoRange(videoInputBuffer);
+                autoRange(videoInput, videoElementsInBuffer, processAudioState.v_read);
             }
 
             // Process the video and audio buffer (only the number of elements read from the file are processed,
@@ -433,52 +603,71 @@ qint32 Tbc::execute(void)
             qDebug() << "Processing the video and audio buffers...";
             bool videoOutputBufferReady = false;
             bool audioOutputBufferReady = false;
+            FrameJob frameJob;
 
             qint32 numberOfVideoBufferElementsProcessed =
-                    processVideoAndAudioBuffer(videoInputBuffer, videoElementsInBuffer,
-                                               audioInputBuffer, processAudioData,
+                    processVideoAndAudioBuffer(videoInput, videoElementsInBuffer,
+                                               audioInputRing, processAudioData,
                                                &videoOutputBufferReady, &audioOutputBufferReady,
-                                               videoOutputBuffer, audioOutputBuffer);
+                                               videoOutputBuffer, audioOutputBuffer,
+                                               collectSyncs ? &frameJob : NULL);
 
             qDebug() << "Processed" << numberOfVideoBufferElementsProcessed << "elements from video buffer";
 
-            // Write the video frame buffer to disk?
+            // Write the video frame buffer to disk (or queue it for resampling)?
+            // Drop the frames outside of the input range (and stop after it)
+            if (useInputRange && videoOutputBufferReady && numberOfVideoBufferElementsProcessed > 0) {
+                reachedInputRangeEnd = (frameJob.position >= inputRangeEnd);
+                frameInInputRange = (frameJob.position >= inputRangeStart) && !reachedInputRangeEnd;
+
+                if (!frameInInputRange) {
+                    qDebug() << "Frame at input position" << frameJob.position << "is outside of the input range - dropping";
+                    videoOutputBufferReady = false;
+                }
+            }
+
             if (videoOutputBufferReady && numberOfVideoBufferElementsProcessed > 0) {
-                if (!tbcConfiguration.audioOutputOnly) {
-                    qDebug() << "Writing frame data to disc";
+                // v_read is still the input position of the start of the buffer here
+                if (syncIndexFileHandle != NULL) writeSyncIndexRecord(syncIndex, processAudioState.v_read, frameJob);
 
-                    // Note: in a 2D vector only the vector is in continuous memory
-                    // not the vector of vectors, so we have to write each contained
-                    // vector seperately here...
-                    for (qint32 line = 0; line < videoOutputBufferNumberOfLines; line++) {
-                        videoOutputFileHandle->write(reinterpret_cast<char *>(videoOutputBuffer[line].data()), videoOutputBuffer[line].size() * sizeof(quint16));
-                    }
-                } else qDebug() << "Audio only selected - discarding video frame data";
+                if (resampleInThreads) {
+                    // Buffered input gets overwritten by the next read, so the job needs its own copy
+                    if (!useVideoInputMap) frameJob.videoInputBuffer = videoInputBuffer;
 
-                // Note: this writes a complete buffer at the end of the file even if
-                // the buffer isn't completely full. Causes the size of file to be a little
-                // bit larger than the original TBC version.
+                    pendingFrames.enqueue(QtConcurrent::run(this, &Tbc::resampleFrame, frameJob));
 
-                // Clear the video output buffer
-                //memset(videoOutputBuffer, 0, sizeof(videoOutputBuffer));
-                for (qint32 line = 0; line < videoOutputBufferNumberOfLines; line++) {
-                    videoOutputBuffer[line].clear();
-                    videoOutputBuffer[line].resize(videoOutputBufferNumberOfSamples);
+                    // Keep enough frames in flight to fill the pool, but no more
+                    while (pendingFrames.size() > tbcConfiguration.threads) {
+                        QVector<QVector<quint16 > > frame = pendingFrames.dequeue().result();
+                        writeVideoFrame(videoOutputFileHandle, frame);
+                    }
+                } else if (collectSyncs) {
+                    QVector<QVector<quint16 > > frame = resampleFrame(frameJob);
+                    writeVideoFrame(videoOutputFileHandle, frame);
+                } else {
+                    writeVideoFrame(videoOutputFileHandle, videoOutputBuffer);
+
+                    // Clear the video output buffer
+                    //memset(videoOutputBuffer, 0, sizeof(videoOutputBuffer));
+                    for (qint32 line = 0; line < videoOutputBufferNumberOfLines; line++) {
+                        videoOutputBuffer[line].clear();
+                        videoOutputBuffer[line].resize(videoOutputBufferNumberOfSamples);
+                    }
                 }
             }
 
-            // Write the audio output buffer to disk?
+            // Write the complete blocks in the audio output buffer to disk?  (audio isn't
+            // processed with an input range)
             if (audioOutputBufferReady && numberOfVideoBufferElementsProcessed > 0) {
-                qDebug() << "Writing audio data to disc";
-                audioOutputFileHandle->write(reinterpret_cast<char *>(audioOutputBuffer.data()), audioOutputBuffer.size() * sizeof(quint16));
+                qint32 audioBlockElements = audioOutputBuffer.size() -
+                        (audioOutputBuffer.size() % audioOuputBufferNumberOfElements);
 
-                // Note: this writes a complete buffer at the end of the file even if
-                // the buffer isn't completely full. Causes the size of file to be a little
-                // bit larger than the original TBC version.
+                qDebug() << "Writing audio data to disc";
+                audioOutputFileHandle->write(reinterpret_cast<char *>(audioOutputBuffer.data()),
+                                             audioBlockElements * sizeof(quint16));
 
-                // Clear the audio output buffer
-                audioOutputBuffer.clear();
-                audioOutputBuffer.resize(audioOuputBufferNumberOfElements);
+                // The part block is kept for next time
+                audioOutputBuffer.remove(0, audioBlockElements);
             }
 
             // Check if the processing found no video in the current buffer... and discard the buffer if required
@@ -486,58 +675,68 @@ qint32 Tbc::execute(void)
                 qDebug() << "No video detected in video buffer, discarding buffer data"; // skipping ahead
 
                 // Set the number of processed bytes to the whole buffer, so all data will be shifted back
-                numberOfVideoBufferElementsProcessed = videoInputBuffer.size();
+                numberOfVideoBufferElementsProcessed = videoInputBufferNumberOfElements;
             }
 
-            // These v_read/a_read variables seem to be used by both processVideoAndAudio and processAudio
-            // as part of the processings... but they are not passed, they are globals.  Messy
-            // They are also only set on the second-pass of those procedures... hopefully the defaults are sane?
-            // Not sure what they are actually for - probably tracking the audio data vs the video data
+            // v_read is the input position of the start of the video buffer, and a_read the
+            // audio sample that goes with it (there's an audio sample every va_ratio video samples).
+            // processAudio() picks audio by absolute position, so the audio input ring just
+            // drops everything before a_read the next time it's topped up
             processAudioState.v_read += numberOfVideoBufferElementsProcessed;
-            numberOfAudioBufferElementsProcessed =
-                    (processAudioState.v_read / processAudioState.va_ratio) - processAudioState.a_read;
-            processAudioState.a_read += numberOfAudioBufferElementsProcessed;
+            processAudioState.a_read = processAudioState.v_read / processAudioState.va_ratio;
 
             // If the current buffer doesn't contain enough data for a complete line, the buffer is shifted around to
             // the beginning of the detected line (detected by the processVideoAndAudioBuffer function) and then refilled
             // to ensure the rest of the line data is in the buffer the next time it is processed
 
-            // Shift back the contents of videoBuffer
-            qDebug() << "Shifting back the video buffer contents by" <<
-                        numberOfVideoBufferElementsProcessed << "elements";
-
-            // We need to remove (videoBufferNumberOfElements - (videoProcessLengthInBytes / sizeof(quint16))
-            // elements from the start of the video buffer (as they are already processed)
-            videoInputBuffer.remove(0, numberOfVideoBufferElementsProcessed);
-
-            // Now we adjust videoBytesReceived to reflect the number of elements still in the buffer
-            // (based on the new size of the buffer due to the remove() operation)
-            videoElementsInBuffer = videoInputBuffer.size();
+            if (useVideoInputMap) {
+                // Mapped input just moves along
+                videoInputPosition += numberOfVideoBufferElementsProcessed;
+            } else {
+                // Shift back the contents of videoBuffer
+                qDebug() << "Shifting back the video buffer contents by" <<
+                            numberOfVideoBufferElementsProcessed << "elements";
 
-            // Now we resize the video buffer back to its original length
-            videoInputBuffer.resize(videoInputBufferNumberOfElements);
+                // We need to remove (videoBufferNumberOfElements - (videoProcessLengthInBytes / sizeof(quint16))
+                // elements from the start of the video buffer (as they are already processed)
+                videoInputBuffer.remove(0, numberOfVideoBufferElementsProcessed);
 
-            // Are we processing audio?
-            if (processAudioData) {
-                // Shift back the audio data buffer by the same amount as the video buffer
-                qDebug() << "Shifting back the audio buffer contents by" <<
-                            numberOfVideoBufferElementsProcessed << "elements";
+                // Now we adjust videoBytesReceived to reflect the number of elements still in the buffer
+                // (based on the new size of the buffer due to the remove() operation)
+                videoElementsInBuffer = videoInputBuffer.size();
 
-                audioInputBuffer.remove(0, numberOfAudioBufferElementsProcessed);
-                audioElementsInBuffer = audioInputBuffer.size();
-                audioInputBuffer.resize(audioInputBufferNumberOfElements);
+                // Now we resize the video buffer back to its original length
+                videoInputBuffer.resize(videoInputBufferNumberOfElements);
             }
         } else qInfo() << "Nothing received from the video input file/stdin";
-    } while ((!videoInputFileHandle->atEnd()) && (receivedVideoBytes > 0)); // Keep going until we hit the end of the video input file
+    } while ((!videoInputAtEnd) && (receivedVideoBytes > 0) && (!reachedInputRangeEnd)); // Keep going until we hit the end of the video input file
+
+    // Write out any frames still being resampled
+    while (!pendingFrames.isEmpty()) {
+        QVector<QVector<quint16 > > frame = pendingFrames.dequeue().result();
+        writeVideoFrame(videoOutputFileHandle, frame);
+    }
+
+    // Write out the last (part) block of audio
+    if (processAudioData && !audioOutputBuffer.isEmpty()) {
+        audioOutputFileHandle->write(reinterpret_cast<char *>(audioOutputBuffer.data()),
+                                     audioOutputBuffer.size() * sizeof(quint16));
+    }
 
     qDebug() << "Closing open files...";
 
-    // Close the video input file handle
+    // Close the video input file handle (the frame jobs are all done with the mapping now)
+    if (videoInputMap != NULL) videoInputFileHandle->unmap(reinterpret_cast<uchar *>(videoInputMap));
     if (videoInputFileHandle->isOpen()) videoInputFileHandle->close();
 
     // Close the video output file handle
     if (videoOutputFileHandle->isOpen()) videoOutputFileHandle->close();
 
+    // Only close the sync index file handle if it was used
+    if (syncIndexFileHandle != NULL) {
+        if (syncIndexFileHandle->isOpen()) syncIndexFileHandle->close();
+    }
+
     // Only close the audio input file handle if it was used
     if (audioInputFileHandle != NULL) {
         if (audioInputFileHandle->isOpen()) audioInputFileHandle->close();
@@ -548,6 +747,8 @@ qint32 Tbc::execute(void)
         if (audioOutputFileHandle->isOpen()) audioOutputFileHandle->close();
     }
 
+    reportBurstPhaseStats();
+
     // Exit with success
     qInfo() << "Processing complete";
     return 0;
@@ -555,6 +756,25 @@ qint32 Tbc::execute(void)
 
 // Private functions -------------------------------------------------------------------------------------
 
+// Write a completed frame to the video output file (unless only audio is wanted)
+void Tbc::writeVideoFrame(QFile *videoOutputFileHandle, QVector<QVector<quint16 > > &videoOutputBuffer)
+{
+    if (!tbcConfiguration.audioOutputOnly) {
+        qDebug() << "Writing frame data to disc";
+
+        // Note: in a 2D vector only the vector is in continuous memory
+        // not the vector of vectors, so we have to write each contained
+        // vector seperately here...
+        for (qint32 line = 0; line < videoOutputBuffer.size(); line++) {
+            videoOutputFileHandle->write(reinterpret_cast<char *>(videoOutputBuffer[line].data()), videoOutputBuffer[line].size() * sizeof(quint16));
+        }
+    } else qDebug() << "Audio only selected - discarding video frame data";
+
+    // Note: this writes a complete buffer at the end of the file even if
+    // the buffer isn't completely full. Causes the size of file to be a little
+    // bit larger than the original TBC version.
+}
+
 // This function automatically finds the input range and
 // calculates where low (-40 IRE) and high (100 IRE) is in the signal
 //
@@ -564,85 +784,73 @@ qint32 Tbc::execute(void)
 //
 // Returns:
 //      videoSyncLevel
-//      videoInputBuffer (by reference)
-quint16 Tbc::autoRange(QVector<quint16> &videoInputBuffer)
+//
+// This is incremental: execute() passes the buffer's absolute position in the input,
+// and only samples that no earlier call has seen (with the shift-back scheme, most of
+// each buffer has been) are fed through longSyncFilter - which also keeps the filter
+// history continuous.  low and high are the lowest and highest levels held for at
+// least checklen samples over the last buffer's worth of input; each is kept in a
+// monotonic deque, so every sample is pushed and popped at most once and the cost is
+// proportional to the new data.
+quint16 Tbc::autoRange(quint16 *videoInputBuffer, qint32 videoInputBufferNumberOfElements, qint64 videoInputBufferPosition)
 {
-    QVector<double_t> longSyncFilterResult(videoInputBuffer.size());
-    bool fullagc = true; // Note: this was a passed parameter, but it was always true
-    qint32 lowloc = -1;
     qint32 checklen = (qint32)(tbcConfiguration.videoInputFrequencyInFsc * 4);
 
-    if (!fullagc) { // Note: Never used as fullagc is always true...
-        autoRangeState.low = 65535;
-        autoRangeState.high = 0;
-    }
+    // TODO: Where does 256 come from? (the filter settling time?)
+    qint64 settleLength = tbcConfiguration.videoInputFrequencyInFsc * 256;
+    qint64 windowLength = videoInputBufferNumberOfElements;
 
     qDebug() << "Scale before auto-ranging is =" << (double)autoRangeState.inputMinimumIreLevel << ':' <<
                 (double)autoRangeState.inputMaximumIreLevel;
 
-    // Phase 1:  Get the low (-40 IRE) and high (?? IRE) values
-    // Note: this code is quite slow...
-    for (int currentVideoBufferElement = 0;
-         currentVideoBufferElement < videoInputBuffer.size();
-         currentVideoBufferElement++) {
-        longSyncFilterResult[currentVideoBufferElement] =
-                autoRangeState.longSyncFilter->feed(videoInputBuffer[currentVideoBufferElement]);
-
-        // TODO: Where does 256 come from? - as the videoInputFrequency is a small (double_t) number
-        // it's likely that 256 is a scaling factor?
-        if ((currentVideoBufferElement > (tbcConfiguration.videoInputFrequencyInFsc * 256)) &&
-                (longSyncFilterResult[currentVideoBufferElement] < autoRangeState.low) &&
-                (longSyncFilterResult[currentVideoBufferElement - checklen] < autoRangeState.low)) {
-            if (longSyncFilterResult[currentVideoBufferElement - checklen] >
-                    longSyncFilterResult[currentVideoBufferElement])
-                autoRangeState.low = longSyncFilterResult[currentVideoBufferElement - checklen];
-            else
-                autoRangeState.low = longSyncFilterResult[currentVideoBufferElement];
-
-            lowloc = currentVideoBufferElement;
-        }
+    if (autoRangeState.filterHistory.size() != checklen) autoRangeState.filterHistory.fill(0, checklen);
 
-        if ((currentVideoBufferElement > (tbcConfiguration.videoInputFrequencyInFsc * 256)) &&
-                (longSyncFilterResult[currentVideoBufferElement] > autoRangeState.high) &&
-                (longSyncFilterResult[currentVideoBufferElement - checklen] > autoRangeState.high)) {
-            if (longSyncFilterResult[currentVideoBufferElement - checklen] <
-                    longSyncFilterResult[currentVideoBufferElement])
-                autoRangeState.high = longSyncFilterResult[currentVideoBufferElement - checklen];
-            else
-                autoRangeState.high = longSyncFilterResult[currentVideoBufferElement];
-        }
-    }
+    // Phase 1:  Get the low (-40 IRE) and high (?? IRE) values from the new samples
+    qint64 firstNew = qMax(autoRangeState.filteredTo, videoInputBufferPosition);
+    qint32 newSamples = (videoInputBufferPosition + videoInputBufferNumberOfElements) - firstNew;
 
-    // Phase 2: Attempt to figure out the 0 IRE porch near the sync
-    if (!fullagc) { // Note: Never used as fullagc is always true...
-        qint32 gap = autoRangeState.high - autoRangeState.low;
-        qint32 nloc;
+    if (newSamples > 0) {
+        QVector<double_t> longSyncFilterResult(newSamples);
+        autoRangeState.longSyncFilter->feed(&videoInputBuffer[firstNew - videoInputBufferPosition],
+                                            longSyncFilterResult.data(), newSamples);
 
-        for (nloc = lowloc;
-             // TODO: Where does 320 come from?
-             (nloc > lowloc - (tbcConfiguration.videoInputFrequencyInFsc * 320)) &&
-             (longSyncFilterResult[nloc] < (autoRangeState.low + (gap / 8))); nloc--);
+        for (qint32 i = 0; i < newSamples; i++) {
+            qint64 position = firstNew + i;
+            double_t current = longSyncFilterResult[i];
+            double_t previous = autoRangeState.filterHistory[position % checklen]; // The output checklen samples ago
+            autoRangeState.filterHistory[position % checklen] = current;
 
-        qDebug() << nloc << (lowloc - nloc) / (double)tbcConfiguration.videoInputFrequencyInFsc << (double)longSyncFilterResult[nloc];
+            if (position <= (autoRangeState.filteredFrom + settleLength)) continue;
 
-        nloc -= (tbcConfiguration.videoInputFrequencyInFsc * 4);
-        qDebug() << nloc << (lowloc - nloc) / (double)tbcConfiguration.videoInputFrequencyInFsc << (double)longSyncFilterResult[nloc];
+            // A level has to be held for checklen samples to count
+            double_t lowLevel = qMax(current, previous);
+            double_t highLevel = qMin(current, previous);
 
-        qDebug() << "Scale before auto-ranging is =" << (double)autoRangeState.inputMinimumIreLevel <<
-                    ':' << (double)autoRangeState.inputMaximumIreLevel;
+            while (!autoRangeState.lowWindow.empty() && (autoRangeState.lowWindow.back().second >= lowLevel))
+                autoRangeState.lowWindow.pop_back();
+            autoRangeState.lowWindow.push_back(std::make_pair(position, lowLevel));
 
-        autoRangeState.inputMaximumIreLevel = (longSyncFilterResult[nloc] - autoRangeState.low) /
-                ((tbcConfiguration.sevenFiveMode) ? 47.5 : 40.0);
-        autoRangeState.inputMinimumIreLevel = autoRangeState.low -
-                (20 * autoRangeState.inputMaximumIreLevel); // Should be in the range of -40 IRE to -60 IRE
+            while (!autoRangeState.highWindow.empty() && (autoRangeState.highWindow.back().second <= highLevel))
+                autoRangeState.highWindow.pop_back();
+            autoRangeState.highWindow.push_back(std::make_pair(position, highLevel));
+        }
 
-        if (autoRangeState.inputMinimumIreLevel < 1) autoRangeState.inputMinimumIreLevel = 1;
-        qDebug() << "Scale after auto-ranging is =" << (double)autoRangeState.inputMinimumIreLevel << ':' <<
-                    (double)autoRangeState.inputMaximumIreLevel;
-    } else {
-        autoRangeState.inputMaximumIreLevel = (autoRangeState.high - autoRangeState.low) / 140.0;
+        autoRangeState.filteredTo = firstNew + newSamples;
     }
 
+    // Drop the levels that have slid out of the window
+    qint64 windowStart = autoRangeState.filteredTo - windowLength;
+    while (!autoRangeState.lowWindow.empty() && (autoRangeState.lowWindow.front().first < windowStart))
+        autoRangeState.lowWindow.pop_front();
+    while (!autoRangeState.highWindow.empty() && (autoRangeState.highWindow.front().first < windowStart))
+        autoRangeState.highWindow.pop_front();
+
+    if (!autoRangeState.lowWindow.empty()) autoRangeState.low = autoRangeState.lowWindow.front().second;
+    if (!autoRangeState.highWindow.empty()) autoRangeState.high = autoRangeState.highWindow.front().second;
+
+    // Phase 2: Set the scale from the sync tip to peak white range
+    autoRangeState.inputMaximumIreLevel = (autoRangeState.high - autoRangeState.low) / 140.0;
+
     autoRangeState.inputMinimumIreLevel = autoRangeState.low;	// -40 IRE to -60 IRE
     if (autoRangeState.inputMinimumIreLevel < 1) autoRangeState.inputMinimumIreLevel = 1;
 
@@ -665,19 +873,21 @@ quint16 Tbc::autoRange(QVector<quint16> &videoInputBuffer)
 //      A flag indicating if the audio buffer is ready to be written to disc (by reference)
 //      The videoOutputBuffer (by reference)
 //      The audioOutputBuffer (by reference)
-qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32 videoInputBufferElementsToProcess,
-                                           QVector<double_t> audioInputBuffer, bool processAudioData,
+qint32 Tbc::processVideoAndAudioBuffer(quint16 *videoInputBuffer, qint32 videoInputBufferElementsToProcess,
+                                           AudioInputRing &audioInputRing, bool processAudioData,
                                            bool *isVideoOutputBufferReadyForWrite, bool *isAudioOutputBufferReadyForWrite,
-                                           QVector<QVector<quint16 > > &videoOutputBuffer, QVector<quint16> &audioOutputBuffer)
+                                           QVector<QVector<quint16 > > &videoOutputBuffer, QVector<quint16> &audioOutputBuffer,
+                                           FrameJob *frameJob)
 {
     // Set the write buffer flag to a default of false (do not write)
     *isVideoOutputBufferReadyForWrite = false;
     *isAudioOutputBufferReadyForWrite = false;
 
-    double_t lineBuffer[tbcConfiguration.inputSamplesPerVideoLine];
+    sample_t lineBuffer[tbcConfiguration.inputSamplesPerVideoLine];
     double_t horizontalSyncs[tbcConfiguration.numberOfVideoLinesPerField];
     qint32 field = -1;
     qint32 offset;
+    qint64 frameInputPosition = 0;
 
     // Starts looking for a vsync 500 samples into the video input buffer (about 1 NTSC frame)
     // 600 samples for PAL
@@ -685,11 +895,14 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
 
     // Note: The video output buffer should be cleared by the calling function (process())
     // before invoking this function
+    //
+    // If frameJob is set, only the sync pass is done here: the field syncs are stored
+    // in frameJob and resampleFrame() fills in a video output buffer later on
 
     // Keep going until we have a valid field
     while (field < 1) {
         // Try to find a vertical sync in the inputBuffer and place the position in 'verticalSync'
-        qint32 verticalSync = findVsync(videoInputBuffer.data(), videoInputBufferElementsToProcess, offset);
+        qint32 verticalSync = findVsync(videoInputBuffer, videoInputBufferElementsToProcess, offset);
 
         bool oddEven = verticalSync > 0; // VSync is for odd field if true (false = even field)
         verticalSync = abs(verticalSync);
@@ -730,7 +943,7 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
 
         // Find all of the horizontal syncs for the current field and place in horizontalSyncs[]
         // horizontalSync[] value is negative if the sync was not found
-        findHsyncs(videoInputBuffer.data(), videoInputBufferElementsToProcess, verticalSync, horizontalSyncs);
+        findHsyncs(videoInputBuffer, videoInputBufferElementsToProcess, verticalSync, horizontalSyncs);
         bool isLineBad[tbcConfiguration.numberOfVideoLinesPerField-1];
 
         // Store any errors in isLineBad[] and store the absolute of the horizontal
@@ -740,6 +953,9 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
             horizontalSyncs[line] = abs(horizontalSyncs[line]);
         }
 
+        // Filtered sync band for the edge searches below, reused from line to line
+        QVector<double_t> endSyncFilterResult;
+
         // Determine vsync->0/7.5IRE transition point (TODO: break into function)
         for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-1; line++) {
             if (isLineBad[line] == true) continue;
@@ -749,12 +965,25 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
             double_t endSync = -1;
             quint16 tPoint = ire_to_in(-20);
 
-            // Find beginning of horizontal sync
+            // The start and end of sync searches are only 6 FSC apart, so the span
+            // covering both is filtered in one block (which goes through the SIMD
+            // kernels for the symmetric esync filters) and each search scans its
+            // part of the result.  This also means the end of sync search sees a
+            // settled filter rather than one just cleared to zero
+            qint32 filterStart = horizontalSyncs[line] - (20 * tbcConfiguration.videoInputFrequencyInFsc);
+            qint32 filterEnd = ceil(horizontalSyncs[line] + (4 * tbcConfiguration.videoInputFrequencyInFsc));
+            endSyncFilterResult.resize(filterEnd - filterStart);
+
             autoRangeState.f_endsync->clear(0);
+            autoRangeState.f_endsync->feed(&videoInputBuffer[filterStart], endSyncFilterResult.data(), filterEnd - filterStart);
+
+            // Find beginning of horizontal sync
+            qint32 windowStart = filterStart;
+            qint32 windowEnd = ceil(horizontalSyncs[line] - (8 * tbcConfiguration.videoInputFrequencyInFsc));
+
             previous = 0;
-            for (qint32 i = horizontalSyncs[line] - (20 * tbcConfiguration.videoInputFrequencyInFsc);
-                 i < horizontalSyncs[line] - (8 * tbcConfiguration.videoInputFrequencyInFsc); i++) {
-                double_t current = autoRangeState.f_endsync->feed(videoInputBuffer[i]);
+            for (qint32 i = windowStart; i < windowEnd; i++) {
+                double_t current = endSyncFilterResult[i - filterStart];
 
                 if ((previous > tPoint) && (current < tPoint)) {
                     // qDebug() << "B" << i << line << hsyncs[line];
@@ -768,11 +997,12 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
             }
 
             // Find end of horizontal sync
-            autoRangeState.f_endsync->clear(0);
-            previous = 0;
-            for (qint32 counter = horizontalSyncs[line] - (2 * tbcConfiguration.videoInputFrequencyInFsc);
-                 counter < horizontalSyncs[line] + (4 * tbcConfiguration.videoInputFrequencyInFsc); counter++) {
-                double_t current = autoRangeState.f_endsync->feed(videoInputBuffer[counter]);
+            windowStart = horizontalSyncs[line] - (2 * tbcConfiguration.videoInputFrequencyInFsc);
+            windowEnd = filterEnd;
+
+            previous = endSyncFilterResult[windowStart - filterStart - 1];
+            for (qint32 counter = windowStart; counter < windowEnd; counter++) {
+                double_t current = endSyncFilterResult[counter - filterStart];
 
                 if ((previous < tPoint) && (current > tPoint)) {
                     // qDebug() << "E" << line << hsyncs[line];
@@ -814,8 +1044,9 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
 
             }
 
-            // Colour burst detection/correction
-            scale(videoInputBuffer.data(), lineBuffer, line1, line2, tbcConfiguration.dotsPerVideoLine * tbcConfiguration.videoInputFrequencyInFsc);
+            // Colour burst detection/correction (only the first 14 dots of the line are needed)
+            scale(videoInputBuffer, lineBuffer, line1, line2, tbcConfiguration.dotsPerVideoLine * tbcConfiguration.videoInputFrequencyInFsc,
+                  0, 0, 14 * tbcConfiguration.videoInputFrequencyInFsc);
             if (!burstDetect2(lineBuffer, tbcConfiguration.videoInputFrequencyInFsc, 4, bLevel[line], bPhase, phaseFlip)) {
                 qDebug() << "Error (no burst) on line" << line;
                 isLineBad[line] = true;
@@ -836,81 +1067,106 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
         bool fieldPhase = fabs(tpEven / nEven) < fabs(tpOdd / nOdd);
         qDebug() << "Phases:" << nEven + nOdd << (double)(tpEven / nEven) << (double)(tpOdd / nOdd) << fieldPhase;
 
-        for (qint32 pass = 0; pass < 4; pass++) {
-               for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-1; line++) {
-            bool lPhase = ((line % 2) == 0);
-            if (fieldPhase) lPhase = !lPhase;
+        // Align each line to its colour burst.  burstPhaseDFT() measures the phase directly
+        // (rather than from averaged zero crossings), so the first pass gets each line close
+        // and later passes only re-measure the lines that are still more than
+        // burstPhaseTolerance cycles off; it stops as soon as a pass has nothing to adjust
+        bool isLineAligned[tbcConfiguration.numberOfVideoLinesPerField-1];
+        BurstPhaseStats fieldStats = BurstPhaseStats();
 
-            // TODO: Why 14.0?
-            double_t line1c = horizontalSyncs[line] + ((horizontalSyncs[line + 1] - horizontalSyncs[line]) * 14.0 / tbcConfiguration.dotsPerVideoLine);
+        for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-1; line++) isLineAligned[line] = false;
 
-            scale(videoInputBuffer.data(), lineBuffer, horizontalSyncs[line], line1c, 14 * tbcConfiguration.videoInputFrequencyInFsc);
-            if (!burstDetect2(lineBuffer, tbcConfiguration.videoInputFrequencyInFsc, 4, bLevel[line], bPhase, phaseFlip)) {
-                isLineBad[line] = true;
-                continue; // Exits the for loop...
-            }
+        for (qint32 pass = 0; pass < tbcConfiguration.burstPhasePasses; pass++) {
+            fieldStats.passes++;
+            fieldStats.linesUnconverged = 0;
+            fieldStats.maxPhaseError = 0;
 
-            // TODO: why .260?
-            double_t tgt = .260;
-//			if (bphase > .5) tgt += .5;
+            for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-1; line++) {
+                if (isLineAligned[line]) continue;
 
-            double_t adj = (tgt - bPhase) * 8;
+                // TODO: Why 14.0?
+                double_t line1c = horizontalSyncs[line] + ((horizontalSyncs[line + 1] - horizontalSyncs[line]) * 14.0 / tbcConfiguration.dotsPerVideoLine);
+                double_t fitResidual;
 
-            //qDebug() << "ADJ" << line << pass << bphase << tgt << adj;
-            horizontalSyncs[line] -= adj;
-           }
-        }
+                scale(videoInputBuffer, lineBuffer, horizontalSyncs[line], line1c, 14 * tbcConfiguration.videoInputFrequencyInFsc);
+                fieldStats.linesMeasured++;
+                if (!burstPhaseDFT(lineBuffer, tbcConfiguration.videoInputFrequencyInFsc, 4, bLevel[line], bPhase, phaseFlip, fitResidual)) {
+                    isLineBad[line] = true;
+                    continue; // Exits the for loop...
+                }
+                fieldStats.fitResidualTotal += fitResidual;
 
-        correctDamagedHSyncs(horizontalSyncs, isLineBad);
+                // TODO: why .260?
+                double_t tgt = .260;
+                double_t phaseError = tgt - bPhase;
 
-        // Final output (this had a bug in the original code (line < 252) which caused oline to overflow to 505 -
-        // which causes a segfault in the line "frameBuffer[oline][t] = (quint16)clamp(o, 1, 65535);"
-        for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-2; line++) {
-            double_t line1 = horizontalSyncs[line], line2 = horizontalSyncs[line + 1];
-            qint32 oline = 3 + (line * 2) + (oddEven ? 0 : 1);
+                if (fabs(phaseError) > fieldStats.maxPhaseError) fieldStats.maxPhaseError = fabs(phaseError);
+
+                if (fabs(phaseError) < tbcConfiguration.burstPhaseTolerance) {
+                    isLineAligned[line] = true;
+                    continue;
+                }
 
-            // 33 degree shift
-            double_t shift33 = (33.0 / 360.0) * 4 * 2;
+                // The error is in subcarrier cycles, and a cycle is videoInputFrequencyInFsc
+                // input samples (not always 8)
+                double_t adj = phaseError * tbcConfiguration.videoInputFrequencyInFsc;
 
-            // TODO: Remove?
-            if (tbcConfiguration.videoInputFrequencyInFsc == 4) {
-                // XXX THIS IS BUGGED, but works
-                shift33 = (107.0 / 360.0) * 4 * 2;
+                //qDebug() << "ADJ" << line << pass << bphase << tgt << adj;
+                horizontalSyncs[line] -= adj;
+                fieldStats.linesUnconverged++;
             }
 
-            double_t pt = -12 - shift33; // align with previous-gen tbc output
+            if (fieldStats.linesUnconverged == 0) break;
+        }
 
-            scale(videoInputBuffer.data(), lineBuffer, line1 + pt, line2 + pt, 910, 0);
+        qDebug() << "Burst phase: passes" << fieldStats.passes << "measured" << fieldStats.linesMeasured <<
+                    "unconverged" << fieldStats.linesUnconverged << "max error" << (double)fieldStats.maxPhaseError <<
+                    "mean residual" << (double)(fieldStats.linesMeasured ? fieldStats.fitResidualTotal / fieldStats.linesMeasured : 0);
+
+        // Add the field to the run's totals (reported at the end of execute())
+        fieldStats.fields = 1;
+        addBurstPhaseStats(fieldStats);
+
+        correctDamagedHSyncs(horizontalSyncs, isLineBad);
 
+        // Audio only depends on the line positions, so it's processed here (in order)
+        // whether or not the video is resampled later on
+        for (qint32 line = 0; processAudioData && (line < tbcConfiguration.numberOfVideoLinesPerField-2); line++) {
             // 525 is the NTSC number of lines
             double_t framePosition = (line / 525.0) + processLineState.frameno + (field * .50);
 
             if (!field) framePosition -= .001;
 
-            // Process audio?
-            if (processAudioData) {
-                *isAudioOutputBufferReadyForWrite =
-                        processAudio(framePosition,processAudioState.v_read + horizontalSyncs[line],
-                                     audioInputBuffer.data(), audioOutputBuffer.data());
-            }
-            bool lphase = ((line % 2) == 0);
-            if (fieldPhase) lphase = !lphase;
-            videoOutputBuffer[oline][0] = (lphase == 0) ? 32768 : 16384;
-            videoOutputBuffer[oline][1] = bLevel[line] * (327.68 / autoRangeState.inputMaximumIreLevel); // ire_to_out(in_to_ire(blevel[line]));
-
-            if (isLineBad[line]) {
-                        videoOutputBuffer[oline][3] = videoOutputBuffer[oline][5] = 65000;
-                    videoOutputBuffer[oline][4] = videoOutputBuffer[oline][6] = 0;
-            }
+            *isAudioOutputBufferReadyForWrite =
+                    processAudio(framePosition,processAudioState.v_read + horizontalSyncs[line],
+                                 audioInputRing, audioOutputBuffer);
+        }
 
-            // TODO: What is 844? It's the number of samples in the output video buffer?
-            for (qint32 t = 4; t < videoOutputBuffer[0].size(); t++) {
-                double_t o = lineBuffer[t];
-                if (tbcConfiguration.performAutoRanging) o = ire_to_out(in_to_ire(o));
+        FieldSyncs fieldSyncs;
+        qint32 syncLines = tbcConfiguration.numberOfVideoLinesPerField-1;
 
-                videoOutputBuffer[oline][t] = (quint16)clamp(o, 1, 65535);
-            }
+        fieldSyncs.horizontalSyncs = QVector<double_t>(syncLines);
+        fieldSyncs.isLineBad = QVector<bool>(syncLines);
+        fieldSyncs.bLevel = QVector<double_t>(syncLines);
+        for (qint32 line = 0; line < syncLines; line++) {
+            fieldSyncs.horizontalSyncs[line] = horizontalSyncs[line];
+            fieldSyncs.isLineBad[line] = isLineBad[line];
+            fieldSyncs.bLevel[line] = bLevel[line];
         }
+        fieldSyncs.fieldPhase = fieldPhase;
+        fieldSyncs.oddEven = oddEven;
+
+        double_t burstScale = 327.68 / autoRangeState.inputMaximumIreLevel;
+
+        if (field == 0) frameInputPosition = processAudioState.v_read + (qint64)fabs(horizontalSyncs[0]);
+
+        if (frameJob) {
+            frameJob->fields[field] = fieldSyncs;
+            frameJob->burstScale = burstScale;
+        } else {
+            resampleField(videoInputBuffer, fieldSyncs, burstScale, videoOutputBuffer);
+        }
+
         if (tbcConfiguration.isNtsc) offset = abs(horizontalSyncs[250]); // Set offset to the end of the 250th line detected
         else offset = abs(horizontalSyncs[300]); // Set offset to the end of the 300th line detected
         // i.e. move video buffer forward slightly less than one NTSC/PAL field
@@ -920,14 +1176,16 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
 
     qDebug() << "Field processed, performing post-processing actions";
 
-    // Perform despackle of field?
-    if (tbcConfiguration.performDespackle) {
-        despackle(videoOutputBuffer);
+    if (frameJob) {
+        // resampleFrame() does the rest
+        frameJob->videoInput = videoInputBuffer;
+        frameJob->position = frameInputPosition;
+    } else {
+        // Decode field VBI data (resampleField() has done any despackling)
+        qint32 pictureNumber = decodeVbiData(videoOutputBuffer);
+        writeFrameInfo(videoOutputBuffer, frameInputPosition, pictureNumber);
     }
 
-    // Decode field VBI data
-    decodeVbiData(videoOutputBuffer);
-
     // TODO: Add check for white flag back in here (as it's not really part of the VBI decoding function
     // and should be split by itself)
 
@@ -943,6 +1201,545 @@ qint32 Tbc::processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32
     return offset;
 }
 
+// Resample the lines of one field into the video output buffer, from the
+// line positions found by processVideoAndAudioBuffer().  This only reads the
+// configuration, so it's safe to run for several frames at once
+void Tbc::resampleField(const quint16 *videoInputBuffer, const FieldSyncs &syncs, double_t burstScale,
+                        QVector<QVector<quint16 > > &videoOutputBuffer)
+{
+    sample_t lineBuffer[tbcConfiguration.inputSamplesPerVideoLine];
+
+    // Despackling runs a line behind, as it needs the next line of the field
+    QVector<quint16> despackleOriginal[2];
+    const quint16 *despackleAbove = NULL;
+    qint32 oline = 0;
+
+    // Final output (this had a bug in the original code (line < 252) which caused oline to overflow to 505 -
+    // which causes a segfault in the line "frameBuffer[oline][t] = (quint16)clamp(o, 1, 65535);"
+    for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerField-2; line++) {
+        double_t line1 = syncs.horizontalSyncs[line], line2 = syncs.horizontalSyncs[line + 1];
+        oline = 3 + (line * 2) + (syncs.oddEven ? 0 : 1);
+
+        // 33 degree shift
+        double_t shift33 = (33.0 / 360.0) * 4 * 2;
+
+        // TODO: Remove?
+        if (tbcConfiguration.videoInputFrequencyInFsc == 4) {
+            // XXX THIS IS BUGGED, but works
+            shift33 = (107.0 / 360.0) * 4 * 2;
+        }
+
+        double_t pt = -12 - shift33; // align with previous-gen tbc output
+
+        scale(videoInputBuffer, lineBuffer, line1 + pt, line2 + pt, 910, 0);
+
+        bool lphase = ((line % 2) == 0);
+        if (syncs.fieldPhase) lphase = !lphase;
+        videoOutputBuffer[oline][0] = (lphase == 0) ? 32768 : 16384;
+        videoOutputBuffer[oline][1] = syncs.bLevel[line] * burstScale; // ire_to_out(in_to_ire(blevel[line]));
+
+        if (syncs.isLineBad[line]) {
+                    videoOutputBuffer[oline][3] = videoOutputBuffer[oline][5] = 65000;
+                videoOutputBuffer[oline][4] = videoOutputBuffer[oline][6] = 0;
+        }
+
+        // TODO: What is 844? It's the number of samples in the output video buffer?
+        for (qint32 t = 4; t < videoOutputBuffer[0].size(); t++) {
+            double_t o = lineBuffer[t];
+            if (tbcConfiguration.performAutoRanging) o = ire_to_out(in_to_ire(o));
+
+            videoOutputBuffer[oline][t] = (quint16)clamp(o, 1, 65535);
+        }
+
+        if (tbcConfiguration.performDespackle && (line > 0))
+            despackleAbove = despackleLine(videoOutputBuffer, oline - 2, despackleAbove, despackleOriginal[line % 2]);
+    }
+
+    // Despackle the last line of the field
+    if (tbcConfiguration.performDespackle)
+        despackleLine(videoOutputBuffer, oline, despackleAbove, despackleOriginal[(tbcConfiguration.numberOfVideoLinesPerField-2) % 2]);
+}
+
+// Worker thread side of processVideoAndAudioBuffer(): resample both fields of a
+// frame and do the post-processing
+QVector<QVector<quint16 > > Tbc::resampleFrame(FrameJob frameJob)
+{
+    QVector<QVector<quint16 > > videoOutputBuffer(tbcConfiguration.numberOfVideoLinesPerFrame);
+
+    for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerFrame; line++)
+        videoOutputBuffer[line].resize(tbcConfiguration.videoOutputFrequencyInFsc * 211);
+
+    for (qint32 field = 0; field < 2; field++) {
+        resampleField(frameJob.videoInputBuffer.isEmpty() ? frameJob.videoInput : frameJob.videoInputBuffer.constData(),
+                      frameJob.fields[field], frameJob.burstScale, videoOutputBuffer);
+    }
+
+    // Decode field VBI data (resampleField() has done any despackling)
+    qint32 pictureNumber = decodeVbiData(videoOutputBuffer);
+    writeFrameInfo(videoOutputBuffer, frameJob.position, pictureNumber);
+
+    return videoOutputBuffer;
+}
+
+// Frame information is stored in line 0 of each output frame, which isn't
+// otherwise used (following the layout the old VBI decoding code used):
+//
+//      [14], [15]  CAV picture number (high word, low word) or 0 if none
+//      [18]-[21]   input position of the frame's first line in samples (high word first)
+void Tbc::writeFrameInfo(QVector<QVector<quint16 > > &videoOutputBuffer, qint64 position, qint32 pictureNumber)
+{
+    if (pictureNumber < 0) pictureNumber = 0;
+
+    videoOutputBuffer[0][14] = pictureNumber >> 16;
+    videoOutputBuffer[0][15] = pictureNumber & 0xffff;
+
+    for (qint32 word = 0; word < 4; word++)
+        videoOutputBuffer[0][18 + word] = (position >> (48 - (word * 16))) & 0xffff;
+}
+
+// Read the frame information from line 0 of an output frame
+//
+// Returns:
+//      position - input position of the frame's first line
+//      pictureNumber - CAV picture number or 0 if none
+void Tbc::readFrameInfo(const quint16 *firstLine, qint64 *position, qint32 *pictureNumber)
+{
+    *pictureNumber = ((qint32)firstLine[14] << 16) | firstLine[15];
+
+    *position = 0;
+    for (qint32 word = 0; word < 4; word++)
+        *position = (*position << 16) | firstLine[18 + word];
+}
+
+// Concatenate the video outputs of several setInputRange() runs (shards), given
+// in input order, into the target video file.  The shards overlap by a frame at
+// each boundary, and any frame that doesn't start after the last one written is
+// a duplicate and is dropped.  The frame positions (and picture numbers, where
+// there are some) are checked for continuity across the joins.
+//
+// Returns:
+//      0 on success, -1 on failure (as execute())
+qint32 Tbc::stitchShards(QStringList shardFileNames)
+{
+    qint32 frameLength = tbcConfiguration.numberOfVideoLinesPerFrame * tbcConfiguration.videoOutputFrequencyInFsc * 211;
+    double_t samplesPerFrame = tbcConfiguration.videoInputFrequencyInFsc * tbcConfiguration.dotsPerVideoLine *
+            (tbcConfiguration.isNtsc ? 525 : 625);
+
+    QFile *videoOutputFileHandle;
+    if (tbcConfiguration.targetVideoFileName.isEmpty()) {
+        videoOutputFileHandle = new QFile;
+        if (!videoOutputFileHandle->open(stdout, QIODevice::WriteOnly)) {
+            // Failed to open stdout
+            qWarning() << "Could not open stdout";
+            return -1;
+        }
+    } else {
+        videoOutputFileHandle = new QFile(tbcConfiguration.targetVideoFileName);
+        if (!videoOutputFileHandle->open(QIODevice::WriteOnly)) {
+            // Failed to open video output file
+            qWarning() << "Could not open specified video output file";
+            return -1;
+        }
+    }
+
+    QVector<quint16> frame(frameLength);
+    qint64 lastPosition = -1;
+    qint32 lastPictureNumber = 0;
+    qint32 framesWritten = 0;
+    qint32 framesDropped = 0;
+    qint32 discontinuities = 0;
+
+    for (qint32 shard = 0; shard < shardFileNames.size(); shard++) {
+        QFile shardFileHandle(shardFileNames[shard]);
+        if (!shardFileHandle.open(QIODevice::ReadOnly)) {
+            qWarning() << "Could not open shard" << shardFileNames[shard];
+            videoOutputFileHandle->close();
+            return -1;
+        }
+        qInfo() << "Stitching" << shardFileNames[shard];
+
+        while (!shardFileHandle.atEnd()) {
+            qint64 receivedBytes = shardFileHandle.read(reinterpret_cast<char *>(frame.data()), frameLength * sizeof(quint16));
+            if (receivedBytes != (qint64)(frameLength * sizeof(quint16))) {
+                qWarning() << "Shard" << shardFileNames[shard] << "ends with a partial frame - ignoring it";
+                break;
+            }
+
+            qint64 position;
+            qint32 pictureNumber;
+            readFrameInfo(frame.constData(), &position, &pictureNumber);
+
+            // Already written from the previous shard?
+            if ((lastPosition >= 0) && (position < lastPosition + (samplesPerFrame / 2))) {
+                framesDropped++;
+                continue;
+            }
+
+            if (lastPosition >= 0) {
+                double_t framesAway = (position - lastPosition) / samplesPerFrame;
+                bool pictureJump = (pictureNumber != 0) && (lastPictureNumber != 0) && (pictureNumber != lastPictureNumber + 1);
+
+                if ((framesAway > 1.5) || pictureJump) {
+                    qWarning() << "Discontinuity before input position" << position << "-" << framesAway <<
+                                  "frames from the last one, picture number" << lastPictureNumber << "to" << pictureNumber;
+                    discontinuities++;
+                }
+            }
+
+            videoOutputFileHandle->write(reinterpret_cast<char *>(frame.data()), frameLength * sizeof(quint16));
+            lastPosition = position;
+            lastPictureNumber = pictureNumber;
+            framesWritten++;
+        }
+
+        shardFileHandle.close();
+    }
+
+    videoOutputFileHandle->close();
+
+    qInfo() << "Stitched" << framesWritten << "frames, dropped" << framesDropped << "duplicates," <<
+               discontinuities << "discontinuities";
+    return 0;
+}
+
+// Work out where to start processing the input file for setSkipFrames() or
+// setSeekPicture().
+//
+// Skipped frames are just found by their nominal length.  A run from the start of
+// the input always drops the first frame it finds (it may be a partial one), so
+// skipping n frames starts n + 1 frames in - and after the seek no frame is dropped.
+// For a picture number,
+// the picture number found at an estimated position gives how many frames away
+// the picture is, and the estimate is moved by that many nominal frames - which
+// takes a few goes as the disc doesn't play at exactly the nominal rate.  Each
+// probe also narrows down the range the picture can be in, and the range is
+// bisected if a step would leave it.
+//
+// Returns:
+//      The input position (in samples) to start processing from
+qint64 Tbc::findSeekPosition(QFile *videoInputFileHandle, quint16 *videoInputMap, qint64 videoInputElements,
+                             qint32 videoInputBufferNumberOfElements)
+{
+    double_t samplesPerFrame = tbcConfiguration.videoInputFrequencyInFsc * tbcConfiguration.dotsPerVideoLine *
+            (tbcConfiguration.isNtsc ? 525 : 625);
+    qint64 lastPosition = qMax((qint64)0, videoInputElements - videoInputBufferNumberOfElements);
+    qint64 position = (tbcConfiguration.skipFrames > 0) ?
+                qMin((qint64)((tbcConfiguration.skipFrames + 1) * samplesPerFrame), lastPosition) : 0;
+
+    if (tbcConfiguration.seekPicture < 0) return position;
+
+    qint64 low = 0;
+    qint64 high = lastPosition;
+
+    for (qint32 probe = 0; probe < 32; probe++) {
+        qint32 framesAhead;
+        qint32 pictureNumber = readPictureNumber(videoInputFileHandle, videoInputMap, videoInputElements,
+                                                 videoInputBufferNumberOfElements, position, &framesAhead);
+
+        if (pictureNumber < 0) {
+            qWarning() << "No picture number found near input position" << position << "- seeking to the estimate";
+            return position;
+        }
+
+        // Frames from the first frame at position to the one wanted
+        qint32 framesAway = tbcConfiguration.seekPicture - (pictureNumber - framesAhead);
+        qDebug() << "Seek probe" << probe << "at" << position << "found picture" << pictureNumber <<
+                    "-" << framesAway << "frames away";
+
+        if (framesAway == 0) return position;
+
+        if (framesAway > 0) low = position + 1; else high = position - 1;
+        if (low > high) break;
+
+        qint64 next = position + (qint64)(framesAway * samplesPerFrame);
+        if ((next < low) || (next > high)) next = low + ((high - low) / 2);
+        position = next;
+    }
+
+    qWarning() << "Could not find picture" << tbcConfiguration.seekPicture << "- starting from input position" << position;
+    return position;
+}
+
+// Find the CAV picture number of the first frame at or after an input position.
+// This runs the sync pass and resamples the frame just as execute() would, but
+// without touching the audio or the output
+//
+// Returns:
+//      The picture number (or -1 if none was found in the next few frames)
+//      framesAhead - how many frames after the first one the picture number came from
+qint32 Tbc::readPictureNumber(QFile *videoInputFileHandle, quint16 *videoInputMap, qint64 videoInputElements,
+                              qint32 videoInputBufferNumberOfElements, qint64 position, qint32 *framesAhead)
+{
+    QVector<quint16> videoInputBuffer;
+    AudioInputRing audioInputRing;
+    QVector<quint16> audioOutputBuffer;
+    QVector<QVector<quint16 > > videoOutputBuffer(tbcConfiguration.numberOfVideoLinesPerFrame);
+
+    // No audio is processed here
+    initAudioInputRing(audioInputRing, 1, 0);
+
+    for (qint32 line = 0; line < tbcConfiguration.numberOfVideoLinesPerFrame; line++)
+        videoOutputBuffer[line].resize(tbcConfiguration.videoOutputFrequencyInFsc * 211);
+
+    // The skip-frames path in processVideoAndAudioBuffer() mustn't kick in here
+    qint32 frameno = processLineState.frameno;
+    processLineState.frameno = tbcConfiguration.skipFrames;
+
+    qint32 pictureNumber = -1;
+    *framesAhead = 0;
+
+    // Give up after a few frames without a picture number (or a few buffers without a frame)
+    for (qint32 attempt = 0; (attempt < 8) && (*framesAhead < 4) && (pictureNumber < 0); attempt++) {
+        qint32 videoElementsInBuffer = (qint32)qMin((qint64)videoInputBufferNumberOfElements, videoInputElements - position);
+        if (videoElementsInBuffer <= 0) break;
+
+        quint16 *videoInput;
+        if (videoInputMap != NULL) {
+            videoInput = videoInputMap + position;
+        } else {
+            videoInputBuffer.resize(videoElementsInBuffer);
+            videoInputFileHandle->seek(position * sizeof(quint16));
+            videoInputFileHandle->read(reinterpret_cast<char *>(videoInputBuffer.data()), videoElementsInBuffer * sizeof(quint16));
+            videoInput = videoInputBuffer.data();
+        }
+
+        bool videoOutputBufferReady = false;
+        bool audioOutputBufferReady = false;
+        FrameJob frameJob;
+
+        qint32 numberOfVideoBufferElementsProcessed =
+                processVideoAndAudioBuffer(videoInput, videoElementsInBuffer, audioInputRing, false,
+                                           &videoOutputBufferReady, &audioOutputBufferReady,
+                                           videoOutputBuffer, audioOutputBuffer, &frameJob);
+
+        if (videoOutputBufferReady && numberOfVideoBufferElementsProcessed > 0) {
+            for (qint32 field = 0; field < 2; field++)
+                resampleField(videoInput, frameJob.fields[field], frameJob.burstScale, videoOutputBuffer);
+
+            pictureNumber = decodeVbiData(videoOutputBuffer);
+            if (pictureNumber < 0) (*framesAhead)++;
+        }
+
+        // As in execute(), a buffer with no video in it is skipped over
+        if (numberOfVideoBufferElementsProcessed <= 0) numberOfVideoBufferElementsProcessed = videoElementsInBuffer;
+        position += numberOfVideoBufferElementsProcessed;
+    }
+
+    processLineState.frameno = frameno;
+
+    return pictureNumber;
+}
+
+// Sync index files ------------------------------------------------------------------------------------
+//
+// A sync index records everything resampleFrame() needs for each frame that
+// processVideoAndAudioBuffer() found, so that a later run over the same input
+// can go straight to resampling (--read-index) rather than searching for the
+// syncs again.  Since each record carries its own input file position it also
+// allows frames to be resampled in any order.
+//
+// The file is a QDataStream (big-endian) made up of a header:
+//
+//      quint32 magic ("LDSI"), qint32 version, qint32 TBC mode,
+//      qint32 lines per field, qint32 input samples per line
+//
+// followed by one record per frame:
+//
+//      qint64 input position of the frame (in samples)
+//      qint32 number of input samples the frame needs from there
+//      double burst scale, double minimum IRE level, double maximum IRE level
+//      then for each field:
+//          bool field phase, bool odd/even,
+//          QVector<double> hsyncs, QVector<bool> bad lines, QVector<double> burst levels
+//
+// The hsync positions are relative to the frame's input position.
+
+static const quint32 syncIndexMagic = 0x4c445349;
+static const qint32 syncIndexVersion = 1;
+
+// Write the sync index header
+void Tbc::writeSyncIndexHeader(QDataStream &syncIndex)
+{
+    syncIndex.setVersion(QDataStream::Qt_5_0);
+
+    syncIndex << syncIndexMagic << syncIndexVersion << (qint32)tbcConfiguration.tbcMode
+              << tbcConfiguration.numberOfVideoLinesPerField << tbcConfiguration.inputSamplesPerVideoLine;
+}
+
+// Read the sync index header
+//
+// Returns:
+//      true if the index was written in the current TBC mode
+bool Tbc::readSyncIndexHeader(QDataStream &syncIndex)
+{
+    quint32 magic;
+    qint32 version, tbcMode, numberOfVideoLinesPerField, inputSamplesPerVideoLine;
+
+    syncIndex.setVersion(QDataStream::Qt_5_0);
+
+    syncIndex >> magic >> version >> tbcMode >> numberOfVideoLinesPerField >> inputSamplesPerVideoLine;
+    if (syncIndex.status() != QDataStream::Ok) return false;
+
+    if (magic != syncIndexMagic || version != syncIndexVersion) {
+        qDebug() << "Sync index file has the wrong magic number or version";
+        return false;
+    }
+
+    if (tbcMode != (qint32)tbcConfiguration.tbcMode ||
+            numberOfVideoLinesPerField != tbcConfiguration.numberOfVideoLinesPerField ||
+            inputSamplesPerVideoLine != tbcConfiguration.inputSamplesPerVideoLine) {
+        qDebug() << "Sync index file was written in a different TBC mode";
+        return false;
+    }
+
+    return true;
+}
+
+// Write a frame's syncs to the sync index (position is the input position that
+// the frame's hsyncs are relative to)
+void Tbc::writeSyncIndexRecord(QDataStream &syncIndex, qint64 position, const FrameJob &frameJob)
+{
+    // The frame needs the input up to its last hsync, plus a line for the resampler
+    double_t lastSync = 0;
+    for (qint32 field = 0; field < 2; field++) {
+        for (qint32 line = 0; line < frameJob.fields[field].horizontalSyncs.size(); line++)
+            lastSync = qMax(lastSync, fabs(frameJob.fields[field].horizontalSyncs[line]));
+    }
+    qint32 length = (qint32)ceil(lastSync) + tbcConfiguration.inputSamplesPerVideoLine;
+
+    syncIndex << position << length << frameJob.burstScale
+              << autoRangeState.inputMinimumIreLevel << autoRangeState.inputMaximumIreLevel;
+
+    for (qint32 field = 0; field < 2; field++) {
+        const FieldSyncs &syncs = frameJob.fields[field];
+        syncIndex << syncs.fieldPhase << syncs.oddEven << syncs.horizontalSyncs << syncs.isLineBad << syncs.bLevel;
+    }
+}
+
+// Read the next frame's syncs from the sync index.  The IRE levels the frame
+// was found with are restored to autoRangeState
+//
+// Returns:
+//      false if the record is truncated or doesn't fit the current TBC mode
+bool Tbc::readSyncIndexRecord(QDataStream &syncIndex, qint64 &position, qint32 &length, FrameJob &frameJob)
+{
+    qint32 syncLines = tbcConfiguration.numberOfVideoLinesPerField-1;
+
+    syncIndex >> position >> length >> frameJob.burstScale
+              >> autoRangeState.inputMinimumIreLevel >> autoRangeState.inputMaximumIreLevel;
+
+    for (qint32 field = 0; field < 2; field++) {
+        FieldSyncs &syncs = frameJob.fields[field];
+        syncIndex >> syncs.fieldPhase >> syncs.oddEven >> syncs.horizontalSyncs >> syncs.isLineBad >> syncs.bLevel;
+
+        if (syncs.horizontalSyncs.size() != syncLines || syncs.isLineBad.size() != syncLines ||
+                syncs.bLevel.size() != syncLines) return false;
+    }
+
+    frameJob.position = position + (qint64)fabs(frameJob.fields[0].horizontalSyncs[0]);
+
+    return (syncIndex.status() == QDataStream::Ok) && (position >= 0) && (length > 0);
+}
+
+// Resample the video input using the frame syncs from a sync index file, in
+// place of the whole sync detection pass.  Frames are written in index order
+//
+// Returns:
+//      0 on success, -1 on failure (as execute())
+qint32 Tbc::resampleFromSyncIndex(QFile *videoInputFileHandle, QFile *videoOutputFileHandle)
+{
+    if (tbcConfiguration.sourceVideoFileName.isEmpty()) {
+        qWarning() << "A sync index can only be used with a video input file (not stdin)";
+        return -1;
+    }
+
+    QFile syncIndexFileHandle(tbcConfiguration.sourceSyncIndexFileName);
+    if (!syncIndexFileHandle.open(QIODevice::ReadOnly)) {
+        // Failed to open sync index file
+        qWarning() << "Could not open specified sync index file";
+        return -1;
+    }
+    qInfo() << "Reading sync index from" << tbcConfiguration.sourceSyncIndexFileName;
+
+    QDataStream syncIndex(&syncIndexFileHandle);
+    if (!readSyncIndexHeader(syncIndex)) {
+        qWarning() << "The sync index file is not valid for this TBC mode";
+        return -1;
+    }
+
+    // The input is memory-mapped if possible, otherwise each frame's range is read in
+    qint64 inputFileSize = videoInputFileHandle->size();
+    qint64 inputFileElements = inputFileSize / sizeof(quint16);
+    quint16 *videoInputMap = reinterpret_cast<quint16 *>(videoInputFileHandle->map(0, inputFileSize));
+    if (videoInputMap == NULL) qDebug() << "Could not memory-map the video input file, using buffered reads";
+
+    // Auto-ranging restores the IRE levels of each frame as it's read, so that stays inline
+    bool resampleInThreads = (tbcConfiguration.threads > 1) && !tbcConfiguration.performAutoRanging;
+    QQueue<QFuture<QVector<QVector<quint16> > > > pendingFrames;
+
+    if (resampleInThreads) QThreadPool::globalInstance()->setMaxThreadCount(tbcConfiguration.threads);
+
+    qint32 result = 0;
+    qint32 frameNumber = 0;
+    qint32 framesWritten = 0;
+
+    while (!syncIndex.atEnd()) {
+        qint64 position;
+        qint32 length;
+        FrameJob frameJob;
+
+        if (!readSyncIndexRecord(syncIndex, position, length, frameJob)) {
+            qWarning() << "Sync index file is truncated or corrupt at frame" << frameNumber;
+            result = -1;
+            break;
+        }
+
+        if (position + length > inputFileElements) {
+            qWarning() << "Sync index frame" << frameNumber << "is beyond the end of the video input file";
+            result = -1;
+            break;
+        }
+
+        // Process skip-frames mode
+        if (frameNumber++ < tbcConfiguration.skipFrames) continue;
+
+        if (videoInputMap != NULL) {
+            frameJob.videoInput = videoInputMap + position;
+        } else {
+            frameJob.videoInput = NULL;
+            frameJob.videoInputBuffer.resize(length);
+            videoInputFileHandle->seek(position * sizeof(quint16));
+            videoInputFileHandle->read(reinterpret_cast<char *>(frameJob.videoInputBuffer.data()), length * sizeof(quint16));
+        }
+
+        if (resampleInThreads) {
+            pendingFrames.enqueue(QtConcurrent::run(this, &Tbc::resampleFrame, frameJob));
+
+            // Keep enough frames in flight to fill the pool, but no more
+            while (pendingFrames.size() > tbcConfiguration.threads) {
+                QVector<QVector<quint16 > > frame = pendingFrames.dequeue().result();
+                writeVideoFrame(videoOutputFileHandle, frame);
+            }
+        } else {
+            QVector<QVector<quint16 > > frame = resampleFrame(frameJob);
+            writeVideoFrame(videoOutputFileHandle, frame);
+        }
+        framesWritten++;
+    }
+
+    // Write out any frames still being resampled
+    while (!pendingFrames.isEmpty()) {
+        QVector<QVector<quint16 > > frame = pendingFrames.dequeue().result();
+        writeVideoFrame(videoOutputFileHandle, frame);
+    }
+
+    if (videoInputMap != NULL) videoInputFileHandle->unmap(reinterpret_cast<uchar *>(videoInputMap));
+    syncIndexFileHandle.close();
+
+    qInfo() << "Resampled" << framesWritten << "frames from the sync index";
+    return result;
+}
+
 // Find the sync signal
 qint32 Tbc::findSync(quint16 *videoInputBuffer, qint32 videoLength)
 {
@@ -963,44 +1760,65 @@ qint32 Tbc::findSync(quint16 *videoInputBuffer, qint32 videoLength)
 //
 // I *think* tgt is the maximum length of a sync pulse in number of input
 // samples; if the sync is longer it results in an error
+//
+// count and errorCount are the number of in-sync-range and out-of-range samples in the
+// last (tgt * 3) samples.  Rather than keeping circular buffers of flags, each block of
+// samples is first turned into per-sample changes to the two counts (+1 for a sample
+// entering the window, -1 for the one leaving it, which is just the same test on the
+// sample windowLength back).  Those loops are branch-free and vectorise; the running
+// sum and the peak search are then a short scalar pass over the block.
 qint32 Tbc::findSync(quint16 *videoInputBuffer, qint32 videoLength, qint32 tgt)
 {
     qint32 pad = 96;
     qint32 result = -1;
 
-    qint32 to_min = ire_to_in(-45), to_max = ire_to_in(-35);
-    qint32 err_min = ire_to_in(-55), err_max = ire_to_in(30);
+    const quint16 to_min = ire_to_in(-45), to_max = ire_to_in(-35);
+    const quint16 err_min = ire_to_in(-55), err_max = ire_to_in(30);
 
-    qint32 circularBufferLength = tgt * 3;
-    QVector<bool> circularBuffer(circularBufferLength);
-    QVector<bool> circularBufferError(circularBufferLength);
+    const qint32 windowLength = tgt * 3;
+    const qint32 blockLength = 256;
+    qint16 countDelta[blockLength], errorDelta[blockLength];
 
     qint32 count = 0, errorCount = 0, peak = 0, locationOfPeak = 0;
 
-    for (qint32 videoSample = 0; (result == -1) && (videoSample < videoLength); videoSample++) {
-        // Is input sample >= -45 IRE and <= -35 IRE?
-        bool isInputSampleInRange = (videoInputBuffer[videoSample] >= to_min) && (videoInputBuffer[videoSample] < to_max);
+    for (qint32 blockStart = 0; (result == -1) && (blockStart < videoLength); blockStart += blockLength) {
+        qint32 blockEnd = qMin(blockStart + blockLength, videoLength);
+        const quint16 *in = &videoInputBuffer[blockStart];
+
+        // Samples entering the window: is the sample >= -45 IRE and < -35 IRE, and
+        // is it <= -55 IRE or >= 30 IRE?
+        for (qint32 i = 0; i < (blockEnd - blockStart); i++) {
+            countDelta[i] = (in[i] >= to_min) & (in[i] < to_max);
+            errorDelta[i] = (in[i] <= err_min) | (in[i] >= err_max);
+        }
 
-        // Is input sample <= -55 IRE or >= 30 IRE?
-        bool isInputSampleOutOfRange = (videoInputBuffer[videoSample] <= err_min) || (videoInputBuffer[videoSample] >= err_max);
+        // Samples leaving it (there are none until the window has filled)
+        qint32 leaveStart = qMax(blockStart, windowLength);
+        if (leaveStart < blockEnd) {
+            const quint16 *out = &videoInputBuffer[leaveStart - windowLength];
+            qint16 *cd = &countDelta[leaveStart - blockStart], *ed = &errorDelta[leaveStart - blockStart];
 
-        if (isInputSampleInRange) count = count - circularBuffer[videoSample % circularBufferLength] + 1;
-        else count = count - circularBuffer[videoSample % circularBufferLength];
-        circularBuffer[videoSample % circularBufferLength] = isInputSampleInRange;
+            for (qint32 i = 0; i < (blockEnd - leaveStart); i++) {
+                cd[i] -= (out[i] >= to_min) & (out[i] < to_max);
+                ed[i] -= (out[i] <= err_min) | (out[i] >= err_max);
+            }
+        }
 
-        if (isInputSampleOutOfRange) errorCount = errorCount - circularBufferError[videoSample % circularBufferLength] + 1;
-        else errorCount = errorCount - circularBufferError[videoSample % circularBufferLength];
-        circularBufferError[videoSample % circularBufferLength] = isInputSampleOutOfRange;
+        for (qint32 videoSample = blockStart; videoSample < blockEnd; videoSample++) {
+            count += countDelta[videoSample - blockStart];
+            errorCount += errorDelta[videoSample - blockStart];
 
-        if (count > peak) {
-            peak = count;
-            locationOfPeak = videoSample;
-        } else if ((count > tgt) && ((videoSample - locationOfPeak) > pad)) {
-            result = locationOfPeak;
+            if (count > peak) {
+                peak = count;
+                locationOfPeak = videoSample;
+            } else if ((count > tgt) && ((videoSample - locationOfPeak) > pad)) {
+                result = locationOfPeak;
 
-            if ((tbcConfiguration.videoInputFrequencyInFsc > 4) && (errorCount > 1)) {
-                qDebug() << "Horizontal Error HERR" << errorCount;
-                result = -result;
+                if ((tbcConfiguration.videoInputFrequencyInFsc > 4) && (errorCount > 1)) {
+                    qDebug() << "Horizontal Error HERR" << errorCount;
+                    result = -result;
+                }
+                break;
             }
         }
     }
@@ -1124,6 +1942,12 @@ bool Tbc::findHsyncs(quint16 *videoBuffer, qint32 videoLength, qint32 offset, do
 // Returns the end location of each linein horizontalSyncs[]
 // Returned location is negative if an error was detected for the video line
 // (caller responsible for freeing array)
+//
+// Line timing is tracked as it goes: the sync-to-sync period is run through a
+// first-order loop filter, and once enough lines in a row have arrived where
+// predicted the next search only covers a short window past the predicted sync.
+// If nothing turns up there (or a line is damaged) lock is dropped and the
+// full 3-line search is used until it settles again.
 bool Tbc::findHsyncs(quint16 *videoBuffer, qint32 videoLength, qint32 offset, double_t *horizontalSyncs, qint32 nlines)
 {
     // sanity check (XXX: assert!)
@@ -1132,36 +1956,73 @@ bool Tbc::findHsyncs(quint16 *videoBuffer, qint32 videoLength, qint32 offset, do
 
     qint32 loc = offset;
 
+    // gap is one line of video
+    double_t gap = tbcConfiguration.dotsPerVideoLine * tbcConfiguration.videoInputFrequencyInFsc;
+
+    // Skip 200 dots beyond the end of the last sync (slightly less than 1 NTSC line)
+    double_t skip = (tbcConfiguration.isNtsc ? 200 : 280) * tbcConfiguration.videoInputFrequencyInFsc;
+
+    qint32 tgt = 8 * tbcConfiguration.videoInputFrequencyInFsc;
+    qint32 wideSearchLength = tbcConfiguration.dotsPerVideoLine * 3 * tbcConfiguration.videoInputFrequencyInFsc;
+
+    // The search starts (gap - skip) before the predicted end of sync; allow 32 dots
+    // of lateness on top of that, plus findSync()'s 96 sample pad
+    qint32 narrowSearchLength = (gap - skip) + (32 * tbcConfiguration.videoInputFrequencyInFsc) + 96;
+
+    // Tracked line period, and how many lines in a row have matched it
+    double_t linePeriod = gap;
+    qint32 lockedLines = 0;
+    const qint32 lockThreshold = 4;
+
     for (qint32 line = 0; line < nlines; line++) {
-        qint32 syncend = findSync(&videoBuffer[loc], tbcConfiguration.dotsPerVideoLine * 3 * tbcConfiguration.videoInputFrequencyInFsc,
-                               8 * tbcConfiguration.videoInputFrequencyInFsc);
+        bool isLocked = (lockedLines >= lockThreshold);
+        qint32 syncend = -1;
 
-        // gap is one line of video
-        double_t gap = tbcConfiguration.dotsPerVideoLine * tbcConfiguration.videoInputFrequencyInFsc;
+        if (isLocked) syncend = findSync(&videoBuffer[loc], narrowSearchLength, tgt);
+
+        if (syncend == -1) {
+            if (isLocked) {
+                qDebug() << "Lost line lock on line" << line;
+                isLocked = false;
+                lockedLines = 0;
+            }
+
+            syncend = findSync(&videoBuffer[loc], wideSearchLength, tgt);
+        }
 
         qint32 err_offset = 0;
         while (syncend < -1) {
             qDebug() << "Error found on line" << line << syncend;
             err_offset += gap;
-            syncend = findSync(&videoBuffer[loc] + err_offset, tbcConfiguration.dotsPerVideoLine * 3 * tbcConfiguration.videoInputFrequencyInFsc,
-                               8 * tbcConfiguration.videoInputFrequencyInFsc);
+            syncend = findSync(&videoBuffer[loc] + err_offset, wideSearchLength, tgt);
             qDebug() << "Error syncend" << syncend;
         }
 
         // If it skips a scan line, fake it
         if ((line > 0) && (line < nlines) && (syncend > (40 * tbcConfiguration.videoInputFrequencyInFsc))) {
-            horizontalSyncs[line] = -(abs(horizontalSyncs[line - 1]) + gap);
+            horizontalSyncs[line] = -(abs(horizontalSyncs[line - 1]) + linePeriod);
             qDebug() << "XX" << line << loc << syncend << (double)horizontalSyncs[line];
             syncend -= gap;
             loc += gap;
+            lockedLines = 0;
         } else {
             horizontalSyncs[line] = loc + syncend;
             if (err_offset) horizontalSyncs[line] = -horizontalSyncs[line];
 
+            // Update the line period from a clean pair of lines; anything more than
+            // 1% of a line off the prediction (or a damaged line) drops lock
+            if ((line > 0) && (syncend >= 0) && !err_offset && (horizontalSyncs[line - 1] > 0)) {
+                double_t periodError = (horizontalSyncs[line] - horizontalSyncs[line - 1]) - linePeriod;
+
+                if (fabs(periodError) < (gap * 0.01)) {
+                    linePeriod += periodError / 8;
+                    lockedLines++;
+                } else lockedLines = 0;
+            } else lockedLines = 0;
+
             if (syncend != -1) {
-                // Skip 200 dots beyond the end of the last sync (slightly less than 1 NTSC line)
-                if (tbcConfiguration.isNtsc) loc += fabs(syncend) + (200 * tbcConfiguration.videoInputFrequencyInFsc);
-                else loc += fabs(syncend) + (280 * tbcConfiguration.videoInputFrequencyInFsc);
+                // Skip to just before the next sync - predicted from the tracked period once locked
+                loc += fabs(syncend) + skip + (isLocked ? (linePeriod - gap) : 0);
             } else {
                 loc += gap;
             }
@@ -1180,8 +2041,8 @@ void Tbc::correctDamagedHSyncs(double_t *hsyncs, bool *err)
         qint32 lprev;
         qint32 lnext;
 
-        for (lprev = line - 1; (err[lprev] == true) && (lprev >= 0); lprev--);
-        for (lnext = line + 1; (err[lnext] == true) && (lnext < tbcConfiguration.numberOfVideoLinesPerField-1); lnext++);
+        for (lprev = line - 1; (lprev >= 0) && (err[lprev] == true); lprev--);
+        for (lnext = line + 1; (lnext < tbcConfiguration.numberOfVideoLinesPerField-1) && (err[lnext] == true); lnext++);
 
         // This shouldn't happen...
         if ((lprev < 0) || (lnext == tbcConfiguration.numberOfVideoLinesPerField-1)) continue;
@@ -1197,63 +2058,162 @@ void Tbc::correctDamagedHSyncs(double_t *hsyncs, bool *err)
     }
 }
 
-// Process a video frame's worth of audio
+// Process a line's worth of audio
+//
+// The 48KHz output samples that fall between the last line and this one are made
+// as a block: the input position of each is worked out from its time (positions
+// are linear in time between two lines, so it's a multiply rather than a divide),
+// the input samples are picked, then both channels are fed through the de-emphasis
+// filters a block at a time.  The sample times are stepped exactly as the old
+// sample-at-a-time loop stepped them, and the same input samples are picked unless
+// a position lands within rounding of a whole input sample (where the neighbouring
+// one could be picked instead).
+//
+// The samples are appended to audioOutputBuffer
 //
 // Returns:
-//      true - if audio buffer is full (and ready to be written to disc)
+//      true - if there's at least one complete block in the audio buffer (ready to be written to disc)
 //      false - audio buffer not ready
-bool Tbc::processAudio(double_t frameBuffer, qint64 loc, double_t *audioInputBuffer, quint16 *audioOutputBuffer)
+bool Tbc::processAudio(double_t frameBuffer, qint64 loc, const AudioInputRing &audioInputRing,
+                       QVector<quint16> &audioOutputBuffer)
 {
-    bool isAudioBufferReadyForWrite = false;
     double_t time = frameBuffer / (30000.0 / 1001.0); // TODO: What are these constants?
     // Note from Chad: 30000/1001.0 is the NTSC frame rate (~29.976), 525 is the # of lines in an NTSC frame
 
     // Default firstloc if required
     if (processAudioState.firstloc == -1) processAudioState.firstloc = loc;
 
-    if (processAudioState.prev_time >= 0) {
-        while (processAudioState.nextAudioSample < time) {
-            double_t i1 = (processAudioState.nextAudioSample - processAudioState.prev_time) /
-                    (time - processAudioState.prev_time);
-            qint64 i = (i1 * (loc - processAudioState.prev_loc)) + processAudioState.prev_loc;
+    if ((processAudioState.prev_time >= 0) && (processAudioState.nextAudioSample < time)) {
+        const double_t samplePeriod = 1.0 / processAudioState.afreq;
+        QVector<double_t> &channelOne = processAudioState.channelOneBlock;
+        QVector<double_t> &channelTwo = processAudioState.channelTwoBlock;
 
-            if (i < processAudioState.v_read) {
-                isAudioBufferReadyForWrite = processAudioSample(processAudioState.audioChannelOneFilter->filterValue(),
-                                   processAudioState.audioChannelTwoFilter->filterValue(), audioOutputBuffer);
-            } else {
-                qint64 index = (i / processAudioState.va_ratio) - processAudioState.a_read;
-                if (index >= (qint64)(sizeof(audioInputBuffer) / sizeof(double_t))) {
-                    qDebug() << "Audio error" << (double)frameBuffer << (double)time << (double)i1
-                             << i << index << (sizeof(audioInputBuffer) / sizeof(double_t));
-                    index = (sizeof(audioInputBuffer) / sizeof(double_t)) - 1;
-                }
-                double_t channelOne = audioInputBuffer[index * 2], channelTwo = audioInputBuffer[(index * 2) + 1];
-                // TODO: Where does 525.0 come from?
-                double_t frameb = (double_t)(i - processAudioState.firstloc) / (double_t)tbcConfiguration.inputSamplesPerVideoLine / 525.0; // TODO: What are these constants?
-                qDebug() << "Audio" << (double)frameBuffer << loc << (double)frameb << (double)i1 << i <<
-                            i - processAudioState.prev_i <<
-                            index << index - processAudioState.prev_index << (double)channelOne << (double)channelTwo;
-                processAudioState.prev_index = index;
-                processAudioState.prev_i = i;
-                isAudioBufferReadyForWrite = processAudioSample(channelOne, channelTwo, audioOutputBuffer);
+        // How many output samples are there before this line?
+        qint32 samples = 0;
+        for (double_t sampleTime = processAudioState.nextAudioSample; sampleTime < time; sampleTime += samplePeriod)
+            samples++;
+
+        if (channelOne.size() < samples) {
+            channelOne.resize(samples);
+            channelTwo.resize(samples);
+        }
+
+        // Input position per second of output
+        double_t positionScale = (double_t)(loc - (qint64)processAudioState.prev_loc) / (time - processAudioState.prev_time);
+        bool haveInput = (audioInputRing.endPosition > audioInputRing.startPosition);
+        bool indexClamped = false;
+
+        // Samples from before the input buffer repeat the last output (these can only be at the start of the
+        // block).  So do all of them if there's no audio input left
+        qint32 sample = 0;
+        double_t sampleTime = processAudioState.nextAudioSample;
+        for (; sample < samples; sample++, sampleTime += samplePeriod) {
+            qint64 i = ((sampleTime - processAudioState.prev_time) * positionScale) + processAudioState.prev_loc;
+            if (haveInput && (i >= processAudioState.v_read)) break;
+
+            processAudioSample(processAudioState.audioChannelOneFilter->filterValue(),
+                               processAudioState.audioChannelTwoFilter->filterValue(), audioOutputBuffer);
+        }
+        qint32 firstSample = sample;
+
+        // Pick the input samples for the rest
+        for (; sample < samples; sample++, sampleTime += samplePeriod) {
+            qint64 i = ((sampleTime - processAudioState.prev_time) * positionScale) + processAudioState.prev_loc;
+            qint64 index = i / processAudioState.va_ratio;
+
+            // Stay within the audio that's in the ring
+            if (index >= audioInputRing.endPosition) {
+                index = audioInputRing.endPosition - 1;
+                indexClamped = true;
+            } else if (index < audioInputRing.startPosition) {
+                index = audioInputRing.startPosition;
+                indexClamped = true;
             }
 
-            processAudioState.nextAudioSample += 1.0 / processAudioState.afreq;
+            // 300000 is likely to do with the video frame rate
+            const double_t *input = audioInputRing.buffer.constData() + ((index & audioInputRing.mask) * 2);
+            channelOne[sample] = input[0] * (65535.0 / 300000.0);
+            channelTwo[sample] = input[1] * (65535.0 / 300000.0);
+        }
+        processAudioState.nextAudioSample = sampleTime;
+
+        if (indexClamped) {
+            qDebug() << "Audio error" << (double)frameBuffer << (double)time << loc << "is outside of the audio input" <<
+                        audioInputRing.startPosition << "-" << audioInputRing.endPosition;
+        }
+
+        // De-emphasis
+        qint32 blockLength = samples - firstSample;
+        processAudioState.audioChannelOneFilter->feed(channelOne.data() + firstSample, channelOne.data() + firstSample, blockLength);
+        processAudioState.audioChannelTwoFilter->feed(channelTwo.data() + firstSample, channelTwo.data() + firstSample, blockLength);
+
+        qint32 outputPosition = audioOutputBuffer.size();
+        audioOutputBuffer.resize(outputPosition + (blockLength * 2));
+        quint16 *output = audioOutputBuffer.data() + outputPosition;
+
+        for (sample = firstSample; sample < samples; sample++) {
+            *output++ = clamp(channelOne[sample] + 32768, 0, 65535);
+            *output++ = clamp(channelTwo[sample] + 32768, 0, 65535);
         }
     }
 
     processAudioState.prev_time = time;
     processAudioState.prev_loc = loc;
 
-    return isAudioBufferReadyForWrite;
+    // 256 stereo samples to a block
+    return audioOutputBuffer.size() >= 512;
 }
 
-// Process a sample of audio (from what to what?)
+// Size the audio input ring for at least minimumSamples samples (rounded up to
+// a power of two, so positions can be masked down to ring indexes) and empty it
+// at the given audio sample position
+void Tbc::initAudioInputRing(AudioInputRing &audioInputRing, qint64 minimumSamples, qint64 position)
+{
+    qint64 samples = 1;
+    while (samples < minimumSamples) samples *= 2;
+
+    audioInputRing.buffer.fill(0, samples * 2);
+    audioInputRing.mask = samples - 1;
+    audioInputRing.startPosition = position;
+    audioInputRing.endPosition = position;
+}
+
+// Drop the samples before keepFrom from the audio input ring, then fill the free
+// space from the audio input file.  Reads go straight into the ring (in up to two
+// parts, when they wrap round), so nothing already read is ever moved
 //
 // Returns:
-//      true - if audio buffer is full (and ready to be written to disc)
-//      false - audio buffer not ready
-bool Tbc::processAudioSample(double_t channelOne, double_t channelTwo, quint16 *audioOutputBuffer)
+//      The number of samples read (or -1 on a read error)
+qint64 Tbc::fillAudioInputRing(QFile *audioInputFileHandle, AudioInputRing &audioInputRing, qint64 keepFrom)
+{
+    const qint64 bytesPerSample = 2 * sizeof(double_t);
+    qint64 capacity = audioInputRing.mask + 1;
+    qint64 samplesRead = 0;
+
+    audioInputRing.startPosition = qMin(qMax(audioInputRing.startPosition, keepFrom), audioInputRing.endPosition);
+
+    while (audioInputRing.endPosition < audioInputRing.startPosition + capacity) {
+        qint64 ringIndex = audioInputRing.endPosition & audioInputRing.mask;
+        qint64 wanted = qMin(audioInputRing.startPosition + capacity - audioInputRing.endPosition, capacity - ringIndex);
+
+        qint64 receivedBytes = audioInputFileHandle->read(reinterpret_cast<char *>(audioInputRing.buffer.data() + (ringIndex * 2)),
+                                                          wanted * bytesPerSample);
+        if (receivedBytes < 0) return -1;
+
+        // Only whole samples are used (a file should never end part way through one)
+        qint64 receivedSamples = receivedBytes / bytesPerSample;
+        audioInputRing.endPosition += receivedSamples;
+        samplesRead += receivedSamples;
+
+        if (receivedSamples < wanted) break;
+    }
+
+    return samplesRead;
+}
+
+// Process a sample of audio (from what to what?)
+// The sample is appended to audioOutputBuffer
+void Tbc::processAudioSample(double_t channelOne, double_t channelTwo, QVector<quint16> &audioOutputBuffer)
 {
     // 300000 is likely to do with the video frame rate
     channelOne = processAudioState.audioChannelOneFilter->feed(channelOne * (65535.0 / 300000.0));
@@ -1262,18 +2222,8 @@ bool Tbc::processAudioSample(double_t channelOne, double_t channelTwo, quint16 *
     channelTwo = processAudioState.audioChannelTwoFilter->feed(channelTwo * (65535.0 / 300000.0));
     channelTwo += 32768;
 
-    audioOutputBuffer[processAudioState.audioOutputBufferPointer * 2] = clamp(channelOne, 0, 65535);
-    audioOutputBuffer[(processAudioState.audioOutputBufferPointer * 2) + 1] = clamp(channelTwo, 0, 65535);
-
-    // Need to pass this buffer back to the main process function and write it to
-    // disk there rather than being buried here...
-    processAudioState.audioOutputBufferPointer++;
-    if (processAudioState.audioOutputBufferPointer == 256) {
-        qDebug() << "Audio buffer is ready to be written";
-        return true;
-    }
-
-    return false;
+    audioOutputBuffer.append(clamp(channelOne, 0, 65535));
+    audioOutputBuffer.append(clamp(channelTwo, 0, 65535));
 }
 
 // If value is less than lowValue, function returns lowValue
@@ -1322,23 +2272,9 @@ inline double_t Tbc::peakdetect_quad(double_t *y)
     return (2 * (y[2] - y[0]) / (2 * (2 * y[1] - y[0] - y[2])));
 }
 
-// Note: Processing performance could probably be improved by changing
-// the interpolate to act directly on the data (rather than one element
-// at a time)...
-
-// Perform bicubic interpolation of the passed values
-// taken from http://www.paulinternet.nl/?page=bicubic
-inline double_t Tbc::cubicInterpolate(quint16 *y, double_t x)
-{
-    double_t p[4];
-    p[0] = y[0]; p[1] = y[1]; p[2] = y[2]; p[3] = y[3];
-
-    return p[1] + 0.5 * x*(p[2] - p[0] + x*(2.0*p[0] - 5.0*p[1] + 4.0*p[2] - p[3] + x*(3.0*(p[1] - p[2]) + p[3] - p[0])));
-}
-
 // This function takes a video line that is the wrong length
 // and interpolates the line to the correct (predicted) length
-void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
+void Tbc::scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end,
                            double_t outlen)
 {
     // Defaults
@@ -1349,7 +2285,7 @@ void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
     scale(buf, outbuf, start, end, outlen, offset, from, to);
 }
 
-void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
+void Tbc::scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end,
                            double_t outlen, double_t offset)
 {
     // Defaults
@@ -1359,7 +2295,11 @@ void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
     scale(buf, outbuf, start, end, outlen, offset, from, to);
 }
 
-void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
+// The interpolation itself (bicubic, see http://www.paulinternet.nl/?page=bicubic)
+// is done by the Resampler, from a table of phases unless resamplerPhases is 0.
+// Note: p1 is an absolute position in the input buffer, so it stays double
+// even when sample_t is float
+void Tbc::scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end,
                            double_t outlen, double_t offset, qint32 from, qint32 to)
 {
     double_t inlen = end - start;
@@ -1368,14 +2308,7 @@ void Tbc::scale(quint16 *buf, double_t *outbuf, double_t start, double_t end,
     if (to == -1) to = (int)outlen;
 
     double_t p1 = start + (offset * perpel);
-    for (qint32 i = from; i < to; i++) {
-        qint32 index = (qint32)p1;
-        if (index < 1) index = 1;
-
-        outbuf[i] = clamp(cubicInterpolate(&buf[index - 1], p1 - index), 0, 65535);
-
-        p1 += perpel;
-    }
+    if (to > from) resampler->resample(buf, &outbuf[from], p1, perpel, to - from);
 }
 
 // Function returns true if v is within the range of l to h
@@ -1393,7 +2326,7 @@ bool Tbc::inRangeCF(double_t v, double_t l, double_t h)
 
 // Function to detect the colour burst signal's location within a line of video
 // Could do with a description of how it works?
-bool Tbc::burstDetect2(double_t *line, qint32 freq, double_t _loc, double_t &plevel,
+bool Tbc::burstDetect2(sample_t *line, qint32 freq, double_t _loc, double_t &plevel,
                            double_t &pphase, bool &phaseflip)
 {
     qint32 len = (6 * freq);
@@ -1510,6 +2443,127 @@ bool Tbc::burstDetect2(double_t *line, qint32 freq, double_t _loc, double_t &ple
     return true;
 }
 
+// Closed-form counterpart of burstDetect2(), used for the phase alignment passes.
+//
+// The burst window (6 cycles from _loc, freq samples to a cycle) is fitted with a
+// sine and cosine at the subcarrier frequency - a least-squares quadrature fit -
+// and the phase comes straight out of atan2().  freq needn't be a whole number
+// (the Domesday Duplicator modes aren't), so the window needn't hold a whole
+// number of cycles either; solving the 2x2 normal equations rather than just
+// correlating keeps the fit exact anyway.  pphase, phaseflip and plevel mean the
+// same as for burstDetect2(); residual is the fraction of the window's (AC)
+// energy the fitted sine doesn't account for, and is what rejects lines with no
+// usable burst along with an amplitude check.
+bool Tbc::burstPhaseDFT(sample_t *line, double_t freq, double_t _loc, double_t &plevel,
+                        double_t &pphase, bool &phaseflip, double_t &residual)
+{
+    qint32 len = qRound(6 * freq);
+    qint32 begin = _loc * freq;
+
+    // The subcarrier over the window (with its mean removed, like the burst's)
+    double_t cosRef[len], sinRef[len];
+    double_t cosAvg = 0, sinAvg = 0, avg = 0;
+    for (qint32 i = 0; i < len; i++) {
+        cosRef[i] = cos((2.0 * M_PI * (begin + i)) / freq);
+        sinRef[i] = sin((2.0 * M_PI * (begin + i)) / freq);
+        cosAvg += cosRef[i];
+        sinAvg += sinRef[i];
+        avg += line[begin + i];
+    }
+    cosAvg /= len;
+    sinAvg /= len;
+    avg /= len;
+
+    double_t c = 0, s = 0, cc = 0, ss = 0, cs = 0, energy = 0;
+    for (qint32 i = 0; i < len; i++) {
+        double_t v = line[begin + i] - avg;
+        double_t cr = cosRef[i] - cosAvg, sr = sinRef[i] - sinAvg;
+
+        c += v * cr;
+        s += v * sr;
+        cc += cr * cr;
+        ss += sr * sr;
+        cs += cr * sr;
+        energy += v * v;
+    }
+
+    // Solve for the burst as a * cos + b * sin
+    double_t det = (cc * ss) - (cs * cs);
+    if (det <= 0) {
+        residual = 1.0;
+        return false;
+    }
+    double_t a = ((c * ss) - (s * cs)) / det;
+    double_t b = ((s * cc) - (c * cs)) / det;
+
+    double_t amplitude = sqrt((a * a) + (b * b));
+    residual = (energy > 0) ? 1.0 - (((a * c) + (b * s)) / energy) : 1.0;
+
+    // Loose versions of the peak ranges burstDetect2() accepts (sampled peaks can
+    // fall short of the true amplitude, hence the allowance at the low end)
+    double_t minAmplitude = (ire_to_in(tbcConfiguration.highBurst ? 11 : 9) - ire_to_in(tbcConfiguration.highBurst ? -11 : -9)) / 4.0;
+    double_t maxAmplitude = (ire_to_in(tbcConfiguration.highBurst ? 23 : 22) - ire_to_in(tbcConfiguration.highBurst ? -23 : -22)) / 2.0;
+
+    if ((amplitude < minAmplitude) || (amplitude > maxAmplitude) || (residual > 0.3)) {
+        qDebug() << "Burst detect error, amplitude =" << (double)amplitude << "residual =" << (double)residual;
+        return false;
+    }
+
+    // Position (in cycles) of the rising zero crossing: x = A sin(2pi(t - phase))
+    double_t phase = atan2(-a, b) / (2.0 * M_PI);
+    if (phase < 0) phase += 1.0;
+
+    // burstDetect2() reports the phase modulo half a cycle, flagged by which half it's in
+    phaseflip = (phase < .5);
+    pphase = phaseflip ? phase : phase - .5;
+
+    plevel = (2.0 * amplitude) / 4.3;
+
+    return true;
+}
+
+// Run burstPhaseDFT() over clean synthetic bursts at a range of phases, at the
+// configured input frequency and at the whole and fractional sample rates the
+// modes use (8fsc, and the 8.94fsc of the NTSC Domesday Duplicator), and check
+// that it gets the phase back
+//
+// Returns:
+//      true if every burst was measured to within 0.01 of a cycle
+bool Tbc::checkBurstPhaseDFT(void)
+{
+    const double_t frequencies[] = {tbcConfiguration.videoInputFrequencyInFsc, 8.0, 32.0 / (315.0 / 88.0)};
+    const double_t burstAmplitude = (ire_to_in(20) - ire_to_in(-20)) / 2.0;
+    bool passed = true;
+
+    for (qint32 f = 0; f < 3; f++) {
+        double_t freq = frequencies[f];
+        qint32 lineLength = (qint32)(14 * freq) + 1;
+        sample_t line[lineLength];
+
+        for (qint32 step = 0; step < 20; step++) {
+            double_t phase = (step + 0.3) / 20.0;
+
+            for (qint32 i = 0; i < lineLength; i++)
+                line[i] = ire_to_in(0) + (burstAmplitude * sin(2.0 * M_PI * ((i / freq) - phase)));
+
+            double_t plevel, pphase, residual;
+            bool phaseflip;
+            bool found = burstPhaseDFT(line, freq, 4, plevel, pphase, phaseflip, residual);
+
+            double_t error = (phaseflip ? pphase : pphase + .5) - phase;
+            error -= floor(error + .5);
+
+            if (!found || (fabs(error) > 0.01)) {
+                qDebug() << "Burst phase check failed at" << (double)freq << "fsc, phase" << (double)phase <<
+                            "found" << found << "error" << (double)error << "residual" << (double)residual;
+                passed = false;
+            }
+        }
+    }
+
+    return passed;
+}
+
 // Describe me
 bool Tbc::isPeak(QVector<double_t> p, qint32 i)
 {
@@ -1521,47 +2575,66 @@ bool Tbc::isPeak(QVector<double_t> p, qint32 i)
 // stores anything in the arrays (and they are huge arrays).
 // So I've removed them...
 //
+// Despackle one output line: runs of samples outside of -20 to 140 IRE are
+// replaced from the lines two above and below (the same field).  resampleField()
+// calls this a line behind the resampling, so the line below is still as it was
+// resampled; above is the line above as it was before it was despackled.  If
+// anything is changed, the line is copied to original first
+//
 // Returns:
 //      videoOutputBuffer (by reference)
+//      The line as it was before despackling (for the next line of the field)
 //
 // Note from Chad: despackle is the de-rotting code
-void Tbc::despackle(QVector<QVector<quint16 > > &videoOutputBuffer)
+const quint16 *Tbc::despackleLine(QVector<QVector<quint16 > > &videoOutputBuffer, qint32 inputY,
+                                  const quint16 *above, QVector<quint16> &original)
 {
-    // Create a vector and copy the contents of videoOutputBuffer into it
-    QVector<QVector<quint16 > > originalVideoOutputBuffer(videoOutputBuffer);
-
     qint32 outputX = videoOutputBuffer[0].size(); // Same as number of samples
     qint32 outputY = videoOutputBuffer.size(); // Same as number of lines
 
-    for (qint32 inputY = 22; inputY < outputY; inputY++) {
-        double_t rotDetect = tbcConfiguration.rotDetectLevel * autoRangeState.inputMaximumIreLevel;
+    quint16 *line = videoOutputBuffer[inputY].data();
+    if (inputY < 22) return line;
 
-        for (qint32 inputX = 60; inputX < outputX - 16; inputX++) {
+    // out_to_ire() < -20 and > 140 as output levels
+    const qint32 lowLevel = (qint32)ceil((-20 + 60) * 327.68);
+    const qint32 highLevel = (qint32)floor((140 + 60) * 327.68);
 
-            if ((out_to_ire(videoOutputBuffer[inputY][inputX]) < -20) ||
-                    (out_to_ire(videoOutputBuffer[inputY][inputX]) > 140)) {
+    if (above == NULL) above = videoOutputBuffer[inputY - 2].constData();
+    const quint16 *below = (inputY < (outputY - 3)) ? videoOutputBuffer[inputY + 2].constData() : NULL;
+    const quint16 *lineOriginal = line;
 
-                qDebug() << "Despackle R" <<
-                            inputY <<
-                            inputX <<
-                            (double)rotDetect;
+    double_t rotDetect = tbcConfiguration.rotDetectLevel * autoRangeState.inputMaximumIreLevel;
 
-                for (qint32 m = inputX - 4; (m < (inputX + 14)) && (m < outputX); m++) {
-                    double_t tmp = (((double_t)originalVideoOutputBuffer[inputY - 2][m - 2]) +
-                            ((double_t)originalVideoOutputBuffer[inputY - 2][m + 2])) / 2;
+    for (qint32 inputX = 60; inputX < outputX - 16; inputX++) {
 
-                    if (inputY < (outputY - 3)) {
-                        tmp /= 2;
-                        tmp += ((((double_t)originalVideoOutputBuffer[inputY + 2][m - 2]) +
-                                ((double_t)originalVideoOutputBuffer[inputY + 2][m + 2])) / 4);
-                    }
+        if ((line[inputX] < lowLevel) || (line[inputX] > highLevel)) {
+
+            qDebug() << "Despackle R" <<
+                        inputY <<
+                        inputX <<
+                        (double)rotDetect;
+
+            if (lineOriginal == line) {
+                original.resize(outputX);
+                memcpy(original.data(), line, outputX * sizeof(quint16));
+                lineOriginal = original.constData();
+            }
+
+            for (qint32 m = inputX - 4; (m < (inputX + 14)) && (m < outputX); m++) {
+                double_t tmp = (((double_t)above[m - 2]) + ((double_t)above[m + 2])) / 2;
 
-                    videoOutputBuffer[inputY][m] = clamp(tmp, 0, 65535);
+                if (below != NULL) {
+                    tmp /= 2;
+                    tmp += ((((double_t)below[m - 2]) + ((double_t)below[m + 2])) / 4);
                 }
-                inputX = inputX + 14;
+
+                line[m] = clamp(tmp, 0, 65535);
             }
+            inputX = inputX + 14;
         }
     }
+
+    return lineOriginal;
 }
 
 // Read data encoded in the VBI
@@ -1650,7 +2723,8 @@ bool Tbc::checkWhiteFlag(qint32 l, QVector<QVector<quint16 > > videoOutputBuffer
 //
 // Returns:
 //      videoOutputBuffer (by reference)
-void Tbc::decodeVbiData(QVector<QVector<quint16 > > &videoOutputBuffer)
+//      The CAV picture number (or -1 if there isn't one)
+qint32 Tbc::decodeVbiData(QVector<QVector<quint16 > > &videoOutputBuffer)
 {
     // For both NTSC and PAL discs there can be a maximum of 3 lines containing
     // data.  The line number is relative to the field order in which the disc
@@ -1704,9 +2778,12 @@ void Tbc::decodeVbiData(QVector<QVector<quint16 > > &videoOutputBuffer)
     }
 
     // Debug for CAV disks
+    qint32 pictureNumber = -1;
     if (interpretVbi.getDiscType() == InterpretVbi::DiscTypes::cav) {
-        if (interpretVbi.isPictureNumberAvailable())
-            qInfo() << "Picture number is:" << interpretVbi.getPictureNumber();
+        if (interpretVbi.isPictureNumberAvailable()) {
+            pictureNumber = interpretVbi.getPictureNumber();
+            qInfo() << "Picture number is:" << pictureNumber;
+        }
     }
 
 //    flags = (clv ? FRAME_INFO_CLV : 0) | (even ? FRAME_INFO_CAV_EVEN : 0) |
@@ -1722,6 +2799,8 @@ void Tbc::decodeVbiData(QVector<QVector<quint16 > > &videoOutputBuffer)
 //    videoOutputBuffer[0][15] = fnum & 0xffff;
 //    videoOutputBuffer[0][16] = clv_time >> 16;
 //    videoOutputBuffer[0][17] = clv_time & 0xffff;
+
+    return pictureNumber;
 }
 
 // Configuration parameter handling functions -----------------------------------------
@@ -1854,6 +2933,79 @@ void Tbc::setMaximumFrames(qint32 value)
     tbcConfiguration.maximumFrames = value;
 }
 
+// Set the picture number to start from (-1 to start from the beginning)
+void Tbc::setSeekPicture(qint32 value)
+{
+    tbcConfiguration.seekPicture = value;
+}
+
+// Set the range of the input video file (in bytes) to output the frames of
+// (endOffset = -1 for the end of the file)
+void Tbc::setInputRange(qint64 startOffset, qint64 endOffset)
+{
+    tbcConfiguration.inputRangeStart = startOffset;
+    tbcConfiguration.inputRangeEnd = endOffset;
+}
+
+// Set the number of threads used to resample fields (1 = resample inline)
+void Tbc::setThreads(qint32 value)
+{
+    if (value < 1) value = 1;
+    tbcConfiguration.threads = value;
+}
+
+// Set the maximum number of burst phase alignment passes per field
+void Tbc::setBurstPhasePasses(qint32 value)
+{
+    if (value < 1) value = 1;
+    tbcConfiguration.burstPhasePasses = value;
+}
+
+// Set how close (in subcarrier cycles) a line's burst phase has to be to the
+// target before it is left alone
+void Tbc::setBurstPhaseTolerance(double_t value)
+{
+    if (value < 0) value = 0;
+    tbcConfiguration.burstPhaseTolerance = value;
+}
+
+// Set the number of fractional phases in the line resampler's table (0 = evaluate
+// the cubic exactly for every sample, which is slower)
+void Tbc::setResamplerPhases(qint32 value)
+{
+    if (value < 0) value = 0;
+    tbcConfiguration.resamplerPhases = value;
+
+    if (resampler != NULL) delete resampler;
+    resampler = new Resampler(value);
+}
+
+// Add one field's burst phase convergence stats to the run's totals
+void Tbc::addBurstPhaseStats(const BurstPhaseStats &fieldStats)
+{
+    burstPhaseStats.fields += fieldStats.fields;
+    burstPhaseStats.passes += fieldStats.passes;
+    burstPhaseStats.linesMeasured += fieldStats.linesMeasured;
+    burstPhaseStats.linesUnconverged += fieldStats.linesUnconverged;
+    burstPhaseStats.fitResidualTotal += fieldStats.fitResidualTotal;
+    if (fieldStats.maxPhaseError > burstPhaseStats.maxPhaseError) burstPhaseStats.maxPhaseError = fieldStats.maxPhaseError;
+    if (fieldStats.linesUnconverged > 0) burstPhaseStats.fieldsUnconverged++;
+}
+
+// Show how the burst phase alignment converged over the run
+void Tbc::reportBurstPhaseStats(void)
+{
+    if (burstPhaseStats.fields == 0) return;
+
+    qInfo() << "Burst phase alignment over" << burstPhaseStats.fields << "fields:";
+    qInfo() << "  Mean passes per field =" << (double)burstPhaseStats.passes / burstPhaseStats.fields;
+    qInfo() << "  Fields with unconverged lines =" << burstPhaseStats.fieldsUnconverged <<
+               "(" << burstPhaseStats.linesUnconverged << "lines )";
+    qInfo() << "  Largest phase error on a last pass =" << (double)burstPhaseStats.maxPhaseError << "cycles";
+    qInfo() << "  Mean fit residual =" <<
+               (double)(burstPhaseStats.linesMeasured ? burstPhaseStats.fitResidualTotal / burstPhaseStats.linesMeasured : 0);
+}
+
 // Set the source video file's file name
 void Tbc::setSourceVideoFile(QString stringValue)
 {
@@ -1877,3 +3029,15 @@ void Tbc::setTargetAudioFile(QString stringValue)
 {
     tbcConfiguration.targetAudioFileName = stringValue;
 }
+
+// Set the sync index file to resample from (instead of finding the syncs)
+void Tbc::setSourceSyncIndexFile(QString stringValue)
+{
+    tbcConfiguration.sourceSyncIndexFileName = stringValue;
+}
+
+// Set the sync index file to write the syncs found to
+void Tbc::setTargetSyncIndexFile(QString stringValue)
+{
+    tbcConfiguration.targetSyncIndexFileName = stringValue;
+}
@@ -34,17 +34,25 @@
 #include <QFile>
 #include <QDataStream>
 #include <QVector>
+#include <QQueue>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 // Needed for reading and writing to stdin/stdout
 #include <stdio.h>
 
+#include <deque>
+
 #include "filter.h"
+#include "resampler.h"
 #include "interpretvbi.h"
 
 class Tbc
 {
 public:
     Tbc();
+    ~Tbc();
 
     // TBC mode enumeration
     enum TbcModes {
@@ -57,6 +65,9 @@ public:
     // Execute the time-based correction
     qint32 execute(void);
 
+    // Concatenate the outputs of several setInputRange() runs into the target video file
+    qint32 stitchShards(QStringList shardFileNames);
+
     // TBC mode settings
     void setTbcMode(TbcModes setting);
 
@@ -68,12 +79,20 @@ public:
     void setRotDetectLevel(double_t value);
     void setSkipFrames(qint32 value);
     void setMaximumFrames(qint32 value);
+    void setSeekPicture(qint32 value);
+    void setInputRange(qint64 startOffset, qint64 endOffset);
+    void setThreads(qint32 value);
+    void setBurstPhasePasses(qint32 value);
+    void setBurstPhaseTolerance(double_t value);
+    void setResamplerPhases(qint32 value);
 
     // TBC file name settings
     void setSourceVideoFile(QString stringValue);
     void setSourceAudioFile(QString stringValue);
     void setTargetVideoFile(QString stringValue);
     void setTargetAudioFile(QString stringValue);
+    void setSourceSyncIndexFile(QString stringValue);
+    void setTargetSyncIndexFile(QString stringValue);
 
 private:
     // TBC Configuration globals
@@ -100,12 +119,21 @@ private:
         double_t rotDetectLevel;
         qint32 skipFrames;
         qint32 maximumFrames;
+        qint32 seekPicture;
+        qint64 inputRangeStart;
+        qint64 inputRangeEnd;
+        qint32 threads;
+        qint32 burstPhasePasses;
+        double_t burstPhaseTolerance;
+        qint32 resamplerPhases;
 
         // Source and target file name configuration
         QString sourceVideoFileName;
         QString sourceAudioFileName;
         QString targetVideoFileName;
         QString targetAudioFileName;
+        QString sourceSyncIndexFileName;
+        QString targetSyncIndexFileName;
     } tbcConfiguration;
 
     // Globals for processAudio()
@@ -114,8 +142,6 @@ private:
         double_t prev_time;
         double_t nextAudioSample;
         size_t prev_loc;
-        qint64 prev_index;
-        qint64 prev_i;
         qint64 firstloc;
 
         qint64 a_read;
@@ -125,7 +151,10 @@ private:
         // Globals for processAudioSample()
         Filter *audioChannelOneFilter;
         Filter *audioChannelTwoFilter;
-        qint32 audioOutputBufferPointer;
+
+        // Blocks of samples for processAudio() (kept to save reallocating them)
+        QVector<double_t> channelOneBlock;
+        QVector<double_t> channelTwoBlock;
     } processAudioState;
 
     // Globals to do with the line processing functions
@@ -143,14 +172,86 @@ private:
 
         double_t inputMaximumIreLevel;
         double_t inputMinimumIreLevel;
+
+        // Incremental state for autoRange(): where in the input longSyncFilter
+        // started and how far it has been fed, its last few outputs, and monotonic deques of (position,
+        // level) giving the low and high levels over the sliding window
+        qint64 filteredFrom;
+        qint64 filteredTo;
+        QVector<double_t> filterHistory;
+        std::deque<std::pair<qint64, double_t> > lowWindow;
+        std::deque<std::pair<qint64, double_t> > highWindow;
     } autoRangeState;
 
+    // Convergence of the burst phase alignment - for one field, or totalled over the run
+    struct BurstPhaseStats {
+        qint32 fields;              // Fields aligned
+        qint32 fieldsUnconverged;   // Fields with lines still outside the tolerance after the last pass
+        qint32 passes;              // Adjustment passes that were run
+        qint32 linesMeasured;       // Burst measurements made over all passes
+        qint32 linesUnconverged;    // Lines still outside the tolerance on the last pass
+        double_t maxPhaseError;     // Largest phase error (in cycles) on the last pass
+        double_t fitResidualTotal;  // Total fraction of burst energy not explained by the fit
+    } burstPhaseStats;
+
+    // Line resampler used by scale()
+    Resampler *resampler;
+
+    // The sync pass results for one field - everything needed to resample it
+    struct FieldSyncs {
+        QVector<double_t> horizontalSyncs;
+        QVector<bool> isLineBad;
+        QVector<double_t> bLevel;
+        bool fieldPhase;
+        bool oddEven;
+    };
+
+    // A frame waiting to be resampled on a worker thread (threads > 1).
+    // videoInput points into the memory-mapped input file, which stays mapped
+    // until execute() is done; for buffered (stdin) input execute() also hands
+    // over a copy of the buffer in videoInputBuffer, which is used instead
+    struct FrameJob {
+        quint16 *videoInput;
+        QVector<quint16> videoInputBuffer;
+        FieldSyncs fields[2];
+        double_t burstScale;
+        qint64 position; // Input position of the frame's first line
+    };
+
+    // The audio input, in a ring buffer indexed by absolute audio sample position
+    // (a sample being a left/right pair).  It holds the samples from startPosition
+    // up to (but not including) endPosition
+    struct AudioInputRing {
+        QVector<double_t> buffer; // (mask + 1) samples
+        qint64 mask;
+        qint64 startPosition;
+        qint64 endPosition;
+    };
+
     // Private functions
-    quint16 autoRange(QVector<quint16> &videoInputBuffer);
-    qint32 processVideoAndAudioBuffer(QVector<quint16> videoInputBuffer, qint32 videoInputBufferElementsToProcess,
-                                      QVector<double_t> audioInputBuffer, bool processAudioData,
+    quint16 autoRange(quint16 *videoInputBuffer, qint32 videoInputBufferNumberOfElements, qint64 videoInputBufferPosition);
+    qint32 processVideoAndAudioBuffer(quint16 *videoInputBuffer, qint32 videoInputBufferElementsToProcess,
+                                      AudioInputRing &audioInputRing, bool processAudioData,
                                       bool *isVideoFrameBufferReadyForWrite, bool *isAudioBufferReadyForWrite,
-                                      QVector<QVector<quint16> > &videoOutputBuffer, QVector<quint16> &audioOutputBuffer);
+                                      QVector<QVector<quint16> > &videoOutputBuffer, QVector<quint16> &audioOutputBuffer,
+                                      FrameJob *frameJob = NULL);
+    void resampleField(const quint16 *videoInputBuffer, const FieldSyncs &syncs, double_t burstScale,
+                       QVector<QVector<quint16> > &videoOutputBuffer);
+    QVector<QVector<quint16> > resampleFrame(FrameJob frameJob);
+    void writeVideoFrame(QFile *videoOutputFileHandle, QVector<QVector<quint16> > &videoOutputBuffer);
+    void writeFrameInfo(QVector<QVector<quint16> > &videoOutputBuffer, qint64 position, qint32 pictureNumber);
+    void readFrameInfo(const quint16 *firstLine, qint64 *position, qint32 *pictureNumber);
+
+    qint32 resampleFromSyncIndex(QFile *videoInputFileHandle, QFile *videoOutputFileHandle);
+
+    qint64 findSeekPosition(QFile *videoInputFileHandle, quint16 *videoInputMap, qint64 videoInputElements,
+                            qint32 videoInputBufferNumberOfElements);
+    qint32 readPictureNumber(QFile *videoInputFileHandle, quint16 *videoInputMap, qint64 videoInputElements,
+                             qint32 videoInputBufferNumberOfElements, qint64 position, qint32 *framesAhead);
+    void writeSyncIndexHeader(QDataStream &syncIndex);
+    bool readSyncIndexHeader(QDataStream &syncIndex);
+    void writeSyncIndexRecord(QDataStream &syncIndex, qint64 position, const FrameJob &frameJob);
+    bool readSyncIndexRecord(QDataStream &syncIndex, qint64 &position, qint32 &length, FrameJob &frameJob);
 
     qint32 findSync(quint16 *videoBuffer, qint32 videoLength);
     qint32 findSync(quint16 *videoBuffer, qint32 videoLength, qint32 tgt);
@@ -165,8 +266,11 @@ private:
 
     void correctDamagedHSyncs(double_t *hsyncs, bool *err);
 
-    bool processAudio(double_t frameBuffer, qint64 loc, double_t *audioInputBuffer, quint16 *audioOutputBuffer);
-    bool processAudioSample(double_t channelOne, double_t channelTwo, quint16 *audioOutputBuffer);
+    bool processAudio(double_t frameBuffer, qint64 loc, const AudioInputRing &audioInputRing,
+                      QVector<quint16> &audioOutputBuffer);
+    void initAudioInputRing(AudioInputRing &audioInputRing, qint64 minimumSamples, qint64 position);
+    qint64 fillAudioInputRing(QFile *audioInputFileHandle, AudioInputRing &audioInputRing, qint64 keepFrom);
+    void processAudioSample(double_t channelOne, double_t channelTwo, QVector<quint16> &audioOutputBuffer);
 
     inline double_t clamp(double_t value, double_t lowValue, double_t highValue);
 
@@ -175,23 +279,28 @@ private:
     inline quint16 ire_to_out(double_t ire);
     double_t out_to_ire(quint16 in);
     inline double_t peakdetect_quad(double_t *y);
-    inline double_t cubicInterpolate(quint16 *y, double_t x);
 
-    void scale(quint16 *buf, double_t *outbuf, double_t start, double_t end, double_t outlen);
-    void scale(quint16 *buf, double_t *outbuf, double_t start, double_t end, double_t outlen, double_t offset);
-    void scale(quint16 *buf, double_t *outbuf, double_t start, double_t end, double_t outlen, double_t offset,
+    void scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end, double_t outlen);
+    void scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end, double_t outlen, double_t offset);
+    void scale(const quint16 *buf, sample_t *outbuf, double_t start, double_t end, double_t outlen, double_t offset,
                qint32 from, qint32 to);
 
     bool inRange(double_t v, double_t l, double_t h);
     bool inRangeCF(double_t v, double_t l, double_t h);
 
-    bool burstDetect2(double_t *line, qint32 freq, double_t _loc, double_t &plevel, double_t &pphase, bool &phaseflip);
+    bool burstDetect2(sample_t *line, qint32 freq, double_t _loc, double_t &plevel, double_t &pphase, bool &phaseflip);
+    bool burstPhaseDFT(sample_t *line, double_t freq, double_t _loc, double_t &plevel, double_t &pphase, bool &phaseflip,
+                       double_t &residual);
+    bool checkBurstPhaseDFT(void);
+    void addBurstPhaseStats(const BurstPhaseStats &fieldStats);
+    void reportBurstPhaseStats(void);
     bool isPeak(QVector<double_t> p, qint32 i);
-    void despackle(QVector<QVector<quint16> > &videoOutputBuffer);
+    const quint16 *despackleLine(QVector<QVector<quint16> > &videoOutputBuffer, qint32 inputY,
+                                 const quint16 *above, QVector<quint16> &original);
 
     quint32 readVbiData(QVector<QVector<quint16 > > videoOutputBuffer, quint16 line);
     bool checkWhiteFlag(qint32 l, QVector<QVector<quint16> > videoOutputBuffer);
-    void decodeVbiData(QVector<QVector<quint16> > &videoOutputBuffer);
+    qint32 decodeVbiData(QVector<QVector<quint16> > &videoOutputBuffer);
 };
 
 // TODO: Clean this up and put it in an enumeration instead
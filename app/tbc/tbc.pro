@@ -1,4 +1,5 @@
 QT -= gui
+QT += concurrent
 
 CONFIG += c++11 console
 CONFIG -= app_bundle
@@ -12,6 +13,11 @@ QMAKE_CXXFLAGS_RELEASE -= -O2
 # add the desired -O3 if not present
 QMAKE_CXXFLAGS_RELEASE *= -O3
 
+# qmake CONFIG+=ld_float resamples lines in single precision (see filter.h)
+ld_float {
+    DEFINES += LD_FLOAT
+}
+
 # The following define makes your compiler emit warnings if you use
 # any feature of Qt which as been marked deprecated (the exact warnings
 # depend on your compiler). Please consult the documentation of the
@@ -30,13 +36,17 @@ release:DESTDIR = ../../
 SOURCES += main.cpp \
     tbcpal.cpp \
     filter.cpp \
+    resampler.cpp \
     tbc.cpp \
     interpretvbi.cpp
 
 HEADERS += \
     tbcpal.h \
     filter.h \
+    resampler.h \
     ../../deemp.h \
+    ../../fir-simd.h \
+    ../../static-filter.h \
     deemp2.h \
     tbc.h \
     interpretvbi.h
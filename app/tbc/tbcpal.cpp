@@ -65,7 +65,7 @@ TbcPal::TbcPal(quint16 fscSetting)
 
         // Filters (used by process() and autoRange())
         longSyncFilter = new Filter(f2_dsync10); // autoRange() uses this
-        f_syncid = new Filter(f2_syncid10);
+        f_syncid = new sf2_syncid10_t(cs2_syncid10_b, cs2_syncid10_a);
         syncid_offset = syncid10_offset;
         break;
 
@@ -78,7 +78,7 @@ TbcPal::TbcPal(quint16 fscSetting)
 
         // Filters  (used by process() and autoRange())
         longSyncFilter = new Filter(f2_dsync32); // autoRange() uses this
-        f_syncid = new Filter(f2_syncid32);
+        f_syncid = new sf2_syncid32_t(cs2_syncid32_b, cs2_syncid32_a);
         syncid_offset = syncid32_offset;
         break;
 
@@ -91,7 +91,7 @@ TbcPal::TbcPal(quint16 fscSetting)
 
         // Filters (used by process() and autoRange())
         longSyncFilter = new Filter(f2_dsync4); // autoRange() uses this
-        f_syncid = new Filter(f2_syncid4);
+        f_syncid = new sf2_syncid4_t(cs2_syncid4_b, cs2_syncid4_a);
         syncid_offset = syncid4_offset;
         break;
 
@@ -104,10 +104,14 @@ TbcPal::TbcPal(quint16 fscSetting)
 
         // Filters (used by process() and autoRange())
         longSyncFilter = new Filter(f2_dsync); // autoRange() uses this
-        f_syncid = new Filter(f2_syncid8);
+        f_syncid = new sf2_syncid8_t(cs2_syncid8_b, cs2_syncid8_a);
         syncid_offset = syncid8_offset;
     }
 
+    // Line resampler (see resampler.h)
+    resampler = NULL;
+    setResamplerPhases(256);
+
     // File names
     setSourceVideoFile(""); // Default is empty
     setSourceAudioFile(""); // Default is empty
@@ -152,6 +156,13 @@ TbcPal::TbcPal(quint16 fscSetting)
     v_read = 0;
     va_ratio = 80;
 
+    // Nothing filtered yet
+    syncCarryOver.bufferPosition = 0;
+    syncCarryOver.filteredTo = 0;
+    syncCarryOver.streamStart = 0;
+    syncCarryOver.searchedTo = 0;
+    syncCarryOver.videoSyncLevel = 0;
+
     // Input scale is from -95 IRE (for pilot signal) to 145 IRE
     // which is a sweep of 240 IRE. 65535 / 240 = 273.0625
     inputMaximumIreLevel = 273.06;
@@ -189,6 +200,12 @@ TbcPal::TbcPal(quint16 fscSetting)
     lineProcessingState.frameno = -1;
 }
 
+// Class destructor function
+TbcPal::~TbcPal()
+{
+    delete resampler;
+}
+
 // Execute the time-based correction process
 // Returns:
 //       0 on success
@@ -322,6 +339,24 @@ qint32 TbcPal::execute(void)
 
     // File tracking variables
     qint64 receivedVideoBytes = 0;
+    bool videoInputAtEnd = false;
+
+    // A video input file is memory-mapped and processed in place, with videoInputPosition
+    // moving along instead of the buffer being shifted back and refilled.  stdin, and the
+    // last (partial) window of a file, still go through videoBuffer
+    quint16 *videoInputMap = NULL;
+    qint64 videoInputMapElements = 0;
+    qint64 videoInputPosition = 0;
+    bool useVideoInputMap = false;
+
+    if (!sourceVideoFileName.isEmpty()) {
+        videoInputMap = reinterpret_cast<quint16 *>(videoInputFileHandle->map(0, inputFileSize));
+
+        if (videoInputMap != NULL) {
+            videoInputMapElements = inputFileSize / sizeof(quint16);
+            useVideoInputMap = true;
+        } else qDebug() << "Could not memory-map the video input file, using buffered reads";
+    }
 
     do {
         qDebug() << "Beginning video TBC processing loop with videoElementsInBuffer =" <<
@@ -329,12 +364,34 @@ qint32 TbcPal::execute(void)
 
         // Calculate processing progress in % (cannot do this for stdin...)
         if (!sourceVideoFileName.isEmpty()) {
-            double_t percentDone = 100.0 - (100.0 / (double_t)inputFileSize) * (double_t)videoInputFileHandle->bytesAvailable();
+            qint64 bytesRemaining = useVideoInputMap ? inputFileSize - (videoInputPosition * (qint64)sizeof(quint16)) :
+                                                       videoInputFileHandle->bytesAvailable();
+            double_t percentDone = 100.0 - (100.0 / (double_t)inputFileSize) * (double_t)bytesRemaining;
             qInfo() << (qint32)percentDone << "% of input file processed";
         }
 
+        // Once there's less than a whole buffer left in the mapped file, carry on with
+        // buffered reads from the current position
+        if (useVideoInputMap && ((videoInputPosition + videoBufferNumberOfElements) > videoInputMapElements)) {
+            qDebug() << "Reached the end of the mapped video input, switching to buffered reads";
+            videoInputFileHandle->seek(videoInputPosition * sizeof(quint16));
+            videoElementsInBuffer = 0;
+            useVideoInputMap = false;
+        }
+
+        quint16 *videoInput;
+
+        if (useVideoInputMap) {
+            videoInput = videoInputMap + videoInputPosition;
+            videoElementsInBuffer = videoBufferNumberOfElements;
+            receivedVideoBytes = (qint64)videoElementsInBuffer * sizeof(quint16);
+            videoInputAtEnd = ((videoInputPosition + videoBufferNumberOfElements) >= videoInputMapElements);
+        } else {
+            videoInput = videoBuffer.data();
+        }
+
         // Fill the video buffer from the video input file
-        while ((videoElementsInBuffer < videoBuffer.size()) && (!videoInputFileHandle->atEnd())) {
+        while ((!useVideoInputMap) && (videoElementsInBuffer < videoBuffer.size()) && (!videoInputFileHandle->atEnd())) {
             qDebug() << "Requesting" << (videoBuffer.size() - videoElementsInBuffer) <<
                         "elements from video file to fill video buffer";
 
@@ -355,6 +412,7 @@ qint32 TbcPal::execute(void)
             // Add the received elements count to the video elements in buffer count
             videoElementsInBuffer += (qint32)(receivedVideoBytes / sizeof(quint16));
         }
+        if (!useVideoInputMap) videoInputAtEnd = videoInputFileHandle->atEnd();
 
         // Are we processing audio data?
         if (processAudioData) {
@@ -385,14 +443,14 @@ qint32 TbcPal::execute(void)
             if (performAutoRanging) {
                 // Perform auto range of input video data
                 qDebug() << "Performing auto ranging...";
-                videoSyncLevel = autoRange(videoBuffer);
+                videoSyncLevel = autoRange(videoInput, videoBufferNumberOfElements);
             }
 
             // Process the video and audio buffer (only the number of elements read from the file are processed,
             // not the whole buffer)
             qDebug() << "Processing the video and audio buffers...";
             bool videoFrameBufferReady = false;
-            qint32 numberOfVideoBufferElementsProcessed = processVideoAndAudioBuffer(videoBuffer, videoElementsInBuffer,
+            qint32 numberOfVideoBufferElementsProcessed = processVideoAndAudioBuffer(videoInput, videoElementsInBuffer,
                                                                                      audioBuffer, processAudioData, videoSyncLevel,
                                                                                      &videoFrameBufferReady);
             qDebug() << "Processed" << numberOfVideoBufferElementsProcessed << "elements from video buffer";
@@ -417,7 +475,7 @@ qint32 TbcPal::execute(void)
                 qDebug() << "No video detected in video buffer, discarding buffer data"; // skipping ahead
 
                 // Set the number of processed bytes to the whole buffer, so all data will be shifted back
-                numberOfVideoBufferElementsProcessed = videoBuffer.size();
+                numberOfVideoBufferElementsProcessed = videoBufferNumberOfElements;
             }
 
             // These v_read/a_read variables seem to be used by both processVideoAndAudio and processAudio
@@ -432,20 +490,25 @@ qint32 TbcPal::execute(void)
             // the beginning of the detected line (detected by the processVideoAndAudioBuffer function) and then refilled
             // to ensure the rest of the line data is in the buffer the next time it is processed
 
-            // Shift back the contents of videoBuffer
-            qDebug() << "Shifting back the video buffer contents by" <<
-                        numberOfVideoBufferElementsProcessed << "elements";
+            if (useVideoInputMap) {
+                // Mapped input just moves along
+                videoInputPosition += numberOfVideoBufferElementsProcessed;
+            } else {
+                // Shift back the contents of videoBuffer
+                qDebug() << "Shifting back the video buffer contents by" <<
+                            numberOfVideoBufferElementsProcessed << "elements";
 
-            // We need to remove (videoBufferNumberOfElements - (videoProcessLengthInBytes / sizeof(quint16))
-            // elements from the start of the video buffer (as they are already processed)
-            videoBuffer.remove(0, numberOfVideoBufferElementsProcessed);
+                // We need to remove (videoBufferNumberOfElements - (videoProcessLengthInBytes / sizeof(quint16))
+                // elements from the start of the video buffer (as they are already processed)
+                videoBuffer.remove(0, numberOfVideoBufferElementsProcessed);
 
-            // Now we adjust videoBytesReceived to reflect the number of elements still in the buffer
-            // (based on the new size of the buffer due to the remove() operation)
-            videoElementsInBuffer = videoBuffer.size();
+                // Now we adjust videoBytesReceived to reflect the number of elements still in the buffer
+                // (based on the new size of the buffer due to the remove() operation)
+                videoElementsInBuffer = videoBuffer.size();
 
-            // Now we resize the video buffer back to its original length
-            videoBuffer.resize(videoBufferNumberOfElements);
+                // Now we resize the video buffer back to its original length
+                videoBuffer.resize(videoBufferNumberOfElements);
+            }
 
             // Are we processing audio?
             if (processAudioData) {
@@ -458,11 +521,12 @@ qint32 TbcPal::execute(void)
                 audioBuffer.resize(audioBufferNumberOfElements);
             }
         } else qInfo() << "Nothing received from the video input file/stdin";
-    } while ((!videoInputFileHandle->atEnd()) && (receivedVideoBytes > 0)); // Keep going until we hit the end of the video input file
+    } while ((!videoInputAtEnd) && (receivedVideoBytes > 0)); // Keep going until we hit the end of the video input file
 
     qDebug() << "Closing open files...";
 
     // Close the video input file handle
+    if (videoInputMap != NULL) videoInputFileHandle->unmap(reinterpret_cast<uchar *>(videoInputMap));
     if (videoInputFileHandle->isOpen()) videoInputFileHandle->close();
 
     // Close the video output file handle
@@ -489,9 +553,9 @@ qint32 TbcPal::execute(void)
 //
 // Returns:
 //      videoSyncLevel
-quint16 TbcPal::autoRange(QVector<quint16> videoBuffer)
+quint16 TbcPal::autoRange(quint16 *videoBuffer, qint32 videoBufferNumberOfElements)
 {
-    QVector<double_t> longSyncFilterResult(videoBuffer.size());
+    QVector<double_t> longSyncFilterResult(videoBufferNumberOfElements);
     qint32 checklen = (qint32)(videoInputFrequencyInFsc * 4);
 
     // Set the low and high default values which get modified
@@ -506,10 +570,10 @@ quint16 TbcPal::autoRange(QVector<quint16> videoBuffer)
     //	f_longsync.clear(0);
 
     // Phase 1:  Get the low (-40 IRE) and high (?? IRE) values
-    for (qint32 currentVideoBufferElement = 0; currentVideoBufferElement < videoBuffer.size(); currentVideoBufferElement++) {
-        // This feed a value into the filter (purpose unknown) and gets a result back
-        longSyncFilterResult[currentVideoBufferElement] = longSyncFilter->feed(videoBuffer[currentVideoBufferElement]);
+    // This feeds the whole buffer into the filter (purpose unknown) and gets the results back
+    longSyncFilter->feed(videoBuffer, longSyncFilterResult.data(), videoBufferNumberOfElements);
 
+    for (qint32 currentVideoBufferElement = 0; currentVideoBufferElement < videoBufferNumberOfElements; currentVideoBufferElement++) {
         // No idea what this logic is doing? But it finds the lowest value for 'low'
         if ((currentVideoBufferElement > (videoInputFrequencyInFsc * 256)) &&
                 (longSyncFilterResult[currentVideoBufferElement] < low) &&
@@ -556,8 +620,8 @@ quint16 TbcPal::autoRange(QVector<quint16> videoBuffer)
 // Returns:
 //      The number of videoBuffer elements that were processed
 //      A flag indicating if the video frame buffer is ready to be written to disc (by reference)
-qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 videoBufferElementsToProcess,
-                                          QVector<double_t> audioBuffer, bool processAudioData, quint16 videoSyncLevel,
+qint32 TbcPal::processVideoAndAudioBuffer(quint16 *videoBuffer, qint32 videoBufferElementsToProcess,
+                                          QVector<double_t> &audioBuffer, bool processAudioData, quint16 videoSyncLevel,
                                           bool *isVideoFrameBufferReadyForWrite)
 {
     // Set the write buffer flag to a default of false (do not write)
@@ -569,29 +633,41 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
     // therefore, lineDetails isn't assigned a size here.
     QVector<LineStruct> lineDetails;
 
-    // Deemphasis filter buffer - a vector of the same number of elements as videoBuffer
-    QVector<quint16> deempFilterBuffer(videoBufferElementsToProcess);
-
-    // What is this for???
-    QVector<double_t> psync(videoBufferElementsToProcess);
-
     // Clear the video frame buffer
     memset(frameBuffer, 0, sizeof(frameBuffer));
 
-    // Clear the line length and sync filters
+    // Clear the line length filter
     f2_linelen.clear(pal_ipline);
-    f_syncid->clear(0);
 
-    // Apply the video line filters to the video buffer
-    // Here we pass the vector buffers by reference as the filter code is very memory-access intensive
-    applyVideoLineFilters(videoBuffer.data(), deempFilterBuffer.data(), psync.data(),
-                          videoBufferElementsToProcess, videoSyncLevel);
+    // Apply the video line filters to the video buffer.  The start of the buffer usually
+    // overlaps the end of the last one, and that part was filtered last time
+    qint32 carriedElements;
+    qint32 psyncLength = applyVideoLineFilters(videoBuffer, videoBufferElementsToProcess, videoSyncLevel,
+                                               &carriedElements);
+
+    // ...and searched for peaks last time, too
+    qint32 peakSearchStart = 1;
+    if (carriedElements > 0) {
+        qint32 shift = v_read - syncCarryOver.bufferPosition;
+
+        for (qint32 i = 0; i < syncCarryOver.peaks.size(); i++) {
+            if (syncCarryOver.peaks[i].center < shift) continue;
+
+            LineStruct line = syncCarryOver.peaks[i];
+            line.center -= shift;
+            line.beginSync = line.endSync = line.center;
+            lineDetails.append(line);
+        }
+
+        peakSearchStart = qMax(peakSearchStart, (qint32)(syncCarryOver.searchedTo - v_read));
+        qDebug() << "Carried over" << carriedElements << "filtered elements and" << lineDetails.size() << "peaks";
+    }
 
     // No idea what this is doing???
     // Could be trying to determine where the line starts in the buffer?
     qDebug() << "Searching for peaks";
-    for (qint32 currentVideoBufferElement = 0;
-         currentVideoBufferElement < videoBufferElementsToProcess - syncid_offset;
+    for (qint32 currentVideoBufferElement = peakSearchStart;
+         currentVideoBufferElement < psyncLength - 1;
          currentVideoBufferElement++) {
         double_t level = psync[currentVideoBufferElement];
 
@@ -611,6 +687,10 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
         }
     } 
 
+    // Keep the peaks for the next call
+    syncCarryOver.peaks = lineDetails;
+    syncCarryOver.searchedTo = v_read + qMax(peakSearchStart, psyncLength - 1);
+
     // Just in case...
     if (lineDetails.size() == 0) {
         qInfo() << "No peaks detected! Cannot continue to process video lines.";
@@ -687,64 +767,61 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
     bool field2 = false;
     qint32 line = -10;
 
-    // To-do:
-    // There seems to be an exception happening around this point in the code where the debug
-    // keeps outputing LONG followed by SHORT and the loop never ends.  Some error handling
-    // code would be a good idea here as it causes an infinite loop sometimes...
+    // Build the line table in one pass over the peaks.  Where a line was missed (the
+    // gap to the previous line is too long) a line is filled in a nominal line length
+    // after the previous one before the peak is looked at again, and a peak too close
+    // to the previous line is dropped.  lineDetails is only ever appended to, and a
+    // peak fills in at most one line per nominal line length of gap, so the cost is
+    // bounded per peak (inserting into and erasing from lineDetails could go back and
+    // forth forever, as the filled-in line used to be closer than a short line)
     //
-    // Seems to be caused by the fact that both the short and long handling code uses lineCounter
-    // as the counter for the for loop, and both contain lineCounter--; which can cause the for
-    // loop to never exit
-    qint32 catchLoopingException = 0;
+    // The peaks before the start are kept as they were (the later passes look back
+    // from the first line), as are any left after the end
+    QVector<LineStruct> peaks;
+    peaks.swap(lineDetails);
+
+    qint32 peakCounter = qMax(1, firstline - 2);
+    lineDetails.reserve(peaks.size() + 16);
+    for (qint32 i = 0; i < peakCounter; i++) lineDetails.append(peaks[i]);
 
     // Process the lines to perform peak detection
     qInfo() << "Performing detection of video lines";
-    for (qint32 lineCounter = firstline - 2;
-         (lineCounter < (firstline + 650)) && (line < 623) && (lineCounter < (qint32)lineDetails.size());
-         lineCounter++) {
-
-        // Catch looping exception described in the comment above
-        catchLoopingException++;
-        if (catchLoopingException > 10000) {
-            qFatal("processVideoAndAudioBuffer() is stuck - Aborting");
-            exit(1);
-        }
-
+    while ((lineDetails.size() < (firstline + 650)) && (line < 623) && (peakCounter < peaks.size())) {
         bool canStartSync = false;
         if ((line < 0) || inRange(line, 310, 317) || inRange(line, 623, 630)) canStartSync = true;
 
-        if (!canStartSync && ((lineDetails[lineCounter].center - lineDetails[lineCounter - 1].center) >
-                              (400 * videoInputFrequencyInFsc)) && (lineDetails[lineCounter].center >
-                                                                    lineDetails[lineCounter - 1].center)) {
-            // Looks like we completely skipped a video line because of corruption - add a new one
-            qDebug() << "LONG video line detected:" << lineCounter <<
-                        (double)lineDetails[lineCounter].center <<
-                        (double)lineDetails[lineCounter].center - (double)lineDetails[lineCounter - 1].center <<
-                        lineDetails.size();
-
-            LineStruct l;
-
-            l.center = lineDetails[lineCounter - 1].center + 1820;
-            l.peak   = lineDetails[lineCounter - 1].peak;
-            l.isBad = true;
-            l.lineNumber = -1;
+        const LineStruct &previous = lineDetails.last();
+        LineStruct candidate = peaks[peakCounter];
+        double_t distance = candidate.center - previous.center;
 
-            lineDetails.insert(lineDetails.begin()+lineCounter, l);
+        if (!canStartSync && (distance > (400 * videoInputFrequencyInFsc))) {
+            // Looks like we completely skipped a video line because of corruption - add a new one
+            qDebug() << "LONG video line detected:" << lineDetails.size() <<
+                        (double)candidate.center <<
+                        (double)distance <<
+                        peakCounter;
+
+            candidate.center = previous.center + pal_ipline;
+            candidate.beginSync = candidate.endSync = candidate.center;
+            candidate.peak = previous.peak;
+            candidate.isBad = true;
+            candidate.lineNumber = -1;
+        } else if (!canStartSync && (distance < (207.5 * videoInputFrequencyInFsc)) && (distance > 0)) {
+            qDebug() << "SHORT video line detected:" << lineDetails.size() <<
+                        (double)candidate.center <<
+                        (double)distance <<
+                        peakCounter;
+
+            peakCounter++;
+            continue;
+        } else {
+            peakCounter++;
+        }
 
-            lineCounter--;
-            line--;
-        } else if (!canStartSync && ((lineDetails[lineCounter].center - lineDetails[lineCounter - 1].center) <
-                                     (207.5 * videoInputFrequencyInFsc)) &&
-                   (lineDetails[lineCounter].center > lineDetails[lineCounter - 1].center)) {
-            qDebug() << "SHORT video line detected:" << lineCounter <<
-                        (double)lineDetails[lineCounter].center <<
-                        (double)lineDetails[lineCounter].center - (double)lineDetails[lineCounter - 1].center <<
-                        lineDetails.size();
+        lineDetails.append(candidate);
+        qint32 lineCounter = lineDetails.size() - 1;
 
-            lineDetails.erase(lineDetails.begin()+lineCounter);
-            lineCounter--;
-            line--;
-        } else if (inRange(lineDetails[lineCounter].peak, canStartSync ? 0.25 : 0.0, 0.5)) {
+        if (inRange(lineDetails[lineCounter].peak, canStartSync ? 0.25 : 0.0, 0.5)) {
             qint32 cbeginsync = 0;
             qint32 cendsync = 0;
             qint32 center = lineDetails[lineCounter].center;
@@ -824,6 +901,9 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
         line++;
     }
 
+    // Keep the rest of the peaks
+    for (; peakCounter < peaks.size(); peakCounter++) lineDetails.append(peaks[peakCounter]);
+
     // Here we look through the resulting 'lineDetails' vector looking for bad lines
     // and, if found, we send them to the handleBadLine function
     line = -1;
@@ -866,7 +946,7 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
             // Process the video line into a corrected video frame
             // Due to the intensity of the memory accessing, using a vector here is extremely slow...
             // So, we pass the pointer to the data (and I'll add an exception handler to the called function)
-            processVideoLineIntoFrame(videoBuffer.data(), &lineDetails, peakCounter, false);
+            processVideoLineIntoFrame(videoBuffer, &lineDetails, peakCounter, false);
 
             // Process audio?
             if (processAudioData) {
@@ -905,37 +985,92 @@ qint32 TbcPal::processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 v
 // Note: I think these filters are cleaning up the video signal to expose the sync
 // to make detection of the frames easier... but I'm not 100%
 //
-// The two filters are very expensive in terms of processing though.  Could be optimised?
+// The two filters are very expensive in terms of processing, so rather than each
+// making a pass over the whole buffer (with the deemphasised video stored in between)
+// the samples are streamed through both a block at a time.  A block stays in the
+// cache from the deemphasis filter through to psync.
+//
+// The deemphasised video is used 16 samples late (the first 16 outputs of the
+// deemp filter aren't used, and the first one after that is taken as zero) and the
+// sync filter's output is then used syncid_offset samples early.  So psync is only
+// complete up to 16 + syncid_offset samples before the end of the buffer.
+//
+// The filters aren't restarted for each buffer: as long as the buffer follows on
+// from (and overlaps) the last one, the overlap's psync is kept and only the new
+// samples are fed in.  Otherwise (or if the sync level has changed) the sync filter
+// starts again from the start of the buffer.
 //
 // Returns:
-//      deempFilterBuffer (by reference)
-//      psync (by reference)
-void TbcPal::applyVideoLineFilters(quint16 *videoBuffer, quint16 *deempFilterBuffer, double_t *psync,
-                                   qint32 videoBufferElementsToProcess, quint16 videoSyncLevel)
+//      psync (global)
+//      The number of elements of psync that are complete
+//      carriedElements - the number of buffer elements that had already been filtered
+qint32 TbcPal::applyVideoLineFilters(quint16 *videoBuffer, qint32 videoBufferElementsToProcess,
+                                     quint16 videoSyncLevel, qint32 *carriedElements)
 {
-    // This feeds the values from videoBuffer into a deemp filter and populates the output from
-    // the filter into filtbuf.  The first 16 values are fed into the filter, but not stored
-    // in the results - What is this for?
-    qInfo() << "Applying deemphasis filter";
-    for (qint32 currentVideoBufferElement = 0;
-         currentVideoBufferElement < videoBufferElementsToProcess;
-         currentVideoBufferElement++) {
-        // Note: f_psync8 is a pre-generated filter from deemp.h with an unknown purpose
-        double_t val = f2_psync8.feed((double)videoBuffer[currentVideoBufferElement]);
-        if (currentVideoBufferElement > 16) deempFilterBuffer[currentVideoBufferElement - 16] = (quint16)val;
+    const qint32 blockLength = 1024;
+    double_t filterResult[blockLength];
+
+    if (psync.size() < videoBufferElementsToProcess) psync.resize(videoBufferElementsToProcess);
+
+    // v_read is the input position of the buffer
+    qint32 filteredFrom = 0;
+    if ((syncCarryOver.filteredTo > 0) && (videoSyncLevel == syncCarryOver.videoSyncLevel) &&
+            (v_read >= syncCarryOver.bufferPosition) && (v_read < syncCarryOver.filteredTo) &&
+            ((v_read + videoBufferElementsToProcess) >= syncCarryOver.filteredTo)) {
+        filteredFrom = syncCarryOver.filteredTo - v_read;
+        memmove(psync.data(), psync.data() + (v_read - syncCarryOver.bufferPosition), filteredFrom * sizeof(double_t));
+    } else {
+        f_syncid->clear(0);
+        syncCarryOver.streamStart = v_read;
+        psync[0] = 0;
     }
+    *carriedElements = filteredFrom;
 
-    // No idea what this is doing??? - performs some kind of de-emphasis on the video buffer
-    qInfo() << "Applying sync filter";
-    for (qint32 currentVideoBufferElement = 0;
-         currentVideoBufferElement < videoBufferElementsToProcess;
-         currentVideoBufferElement++) {
-        double_t val = f_syncid->feed(deempFilterBuffer[currentVideoBufferElement] &&
-                                      (deempFilterBuffer[currentVideoBufferElement] < videoSyncLevel));
-        if (currentVideoBufferElement > syncid_offset) {
-            psync[currentVideoBufferElement - syncid_offset] = val;
+    qInfo() << "Applying deemphasis and sync filters";
+
+    // Note: f_psync8 is a pre-generated filter from deemp.h with an unknown purpose
+    for (qint32 blockStart = filteredFrom; blockStart < videoBufferElementsToProcess; blockStart += blockLength) {
+        qint32 blockSize = qMin(blockLength, videoBufferElementsToProcess - blockStart);
+
+        // Deemphasis (deemp output i is sync input i - 16)
+        f2_psync8.feed(videoBuffer + blockStart, filterResult, blockSize);
+
+        // No idea what this is doing??? - performs some kind of de-emphasis on the video buffer
+        qint32 first = 0;
+        for (qint32 i = 0; i < blockSize; i++) {
+            qint64 syncInput = v_read + blockStart + i - 16 - syncCarryOver.streamStart;
+
+            if (syncInput < 0) {
+                // Not a sync filter input yet
+                first++;
+                continue;
+            }
+
+            quint16 deemp = (syncInput >= 1) ? (quint16)filterResult[i] : 0;
+            filterResult[i] = deemp && (deemp < videoSyncLevel);
+        }
+
+        // Sync filter
+        f_syncid->feed(filterResult + first, filterResult + first, blockSize - first);
+
+        for (qint32 i = first; i < blockSize; i++) {
+            qint32 currentVideoBufferElement = blockStart + i - 16 - syncid_offset;
+            qint64 syncInput = v_read + blockStart + i - 16 - syncCarryOver.streamStart;
+
+            if ((currentVideoBufferElement >= 0) && (syncInput >= syncid_offset + 1))
+                psync[currentVideoBufferElement] = filterResult[i];
         }
     }
+
+    syncCarryOver.bufferPosition = v_read;
+    syncCarryOver.filteredTo = v_read + videoBufferElementsToProcess;
+    syncCarryOver.videoSyncLevel = videoSyncLevel;
+
+    // Clear the rest (which is filled in next time)
+    qint32 psyncLength = qMax(1, videoBufferElementsToProcess - 16 - syncid_offset);
+    for (qint32 i = psyncLength; i < videoBufferElementsToProcess; i++) psync[i] = 0;
+
+    return psyncLength;
 }
 
 // Process a line of video into a frame
@@ -1367,20 +1502,6 @@ inline double_t TbcPal::peakdetect_quad(double_t *y)
     return (2 * (y[2] - y[0]) / (2 * (2 * y[1] - y[0] - y[2])));
 }
 
-// Note: Processing performance could probably be improved by changing
-// the interpolate to act directly on the data (rather than one element
-// at a time)...
-
-// Perform bicubic interpolation of the passed values
-// taken from http://www.paulinternet.nl/?page=bicubic
-inline double_t TbcPal::cubicInterpolate(quint16 *y, double_t x)
-{
-    double_t p[4];
-    p[0] = y[0]; p[1] = y[1]; p[2] = y[2]; p[3] = y[3];
-
-    return p[1] + 0.5 * x*(p[2] - p[0] + x*(2.0*p[0] - 5.0*p[1] + 4.0*p[2] - p[3] + x*(3.0*(p[1] - p[2]) + p[3] - p[0])));
-}
-
 // This function takes a video line that is the wrong length
 // and interpolates the line to the correct (predicted) length
 inline void TbcPal::scale(quint16 *videoBuffer, double_t *outbuf, double_t start, double_t end, double_t outlen)
@@ -1390,15 +1511,8 @@ inline void TbcPal::scale(quint16 *videoBuffer, double_t *outbuf, double_t start
 
     qDebug() << "Scale " << (double)start << ' ' << (double)end << ' ' << (double)outlen ;
 
-    double_t p1 = start;
-    for (qint32 i = 0; i < outlen; i++) {
-        qint32 index = (qint32)p1;
-        if (index < 1) index = 1;
-
-        outbuf[i] = clamp(cubicInterpolate(&videoBuffer[index - 1], p1 - index), 0, 65535);
-
-        p1 += perpel;
-    }
+    // Note: outlen isn't always whole - every i < outlen is written
+    resampler->resample(videoBuffer, outbuf, start, perpel, (qint32)ceil(outlen));
 }
 
 // Function returns true if v is within the range of l to h
@@ -1617,3 +1731,12 @@ void TbcPal::setMaximumFrames(qint32 value)
     qInfo() << "setMaximumFrames is not supported by the PAL TBC" << value;
     //p_maxframes = value;
 }
+
+// Set the number of fractional phases in the line resampler's table (0 = exact)
+void TbcPal::setResamplerPhases(qint32 value)
+{
+    if (value < 0) value = 0;
+
+    if (resampler != NULL) delete resampler;
+    resampler = new Resampler(value);
+}
@@ -39,11 +39,14 @@
 #include <stdio.h>
 
 #include "filter.h"
+#include "resampler.h"
+#include "../../static-filter.h"
 
 class TbcPal
 {
 public:
     TbcPal(quint16 fscSetting);
+    ~TbcPal();
 
     // Execute the time-based correction
     qint32 execute(void);
@@ -65,6 +68,7 @@ public:
     void setRot(double_t value);
     void setSkipFrames(qint32 value);
     void setMaximumFrames(qint32 value);
+    void setResamplerPhases(qint32 value);
 
 private:
     // Private configuration globals that have
@@ -120,8 +124,10 @@ private:
 
     // Global filter declarations
     Filter *longSyncFilter; // Used by autoRange()
-    Filter *f_syncid; // Used by processAudioAndVideo and applyVideoLineFilters
+    StaticFilter<4, true> *f_syncid; // Used by processAudioAndVideo and applyVideoLineFilters (all the syncid filters are 3rd order IIRs)
     qint32 syncid_offset; // Used by processAudioAndVideo and applyVideoLineFilters
+    QVector<double_t> psync; // Sync filter output for processAudioAndVideo (carried between calls)
+    Resampler *resampler; // Used by scale()
 
     // Globals for processAudio() and processAudioSample()
     struct processAudioStateStruct {
@@ -168,13 +174,24 @@ private:
         bool isBad;
     };
 
+    // Where applyVideoLineFilters() and the peak search got to last time, so the
+    // overlap with the next buffer isn't filtered and searched again
+    struct SyncCarryOverStruct {
+        qint64 bufferPosition;  // Input position of the last buffer
+        qint64 filteredTo;      // Input position the filters have been fed up to
+        qint64 streamStart;     // Input position the sync filter was last started from
+        qint64 searchedTo;      // Input position the peak search got up to
+        quint16 videoSyncLevel;
+        QVector<LineStruct> peaks;
+    } syncCarryOver;
+
     // Private functions
-    quint16 autoRange(QVector<quint16> videoBuffer);
-    qint32 processVideoAndAudioBuffer(QVector<quint16> videoBuffer, qint32 len,
-                                      QVector<double_t> audioBuffer, bool processAudioData, quint16 videoSyncLevel,
+    quint16 autoRange(quint16 *videoBuffer, qint32 videoBufferNumberOfElements);
+    qint32 processVideoAndAudioBuffer(quint16 *videoBuffer, qint32 len,
+                                      QVector<double_t> &audioBuffer, bool processAudioData, quint16 videoSyncLevel,
                                       bool *isVideoFrameBufferReadyForWrite);
-    void applyVideoLineFilters(quint16 *videoBuffer, quint16 *deempFilterBuffer, double_t *psync,
-                               qint32 videoBufferElementsToProcess, quint16 videoSyncLevel);
+    qint32 applyVideoLineFilters(quint16 *videoBuffer, qint32 videoBufferElementsToProcess,
+                                 quint16 videoSyncLevel, qint32 *carriedElements);
     double_t processVideoLineIntoFrame(quint16 *videoBuffer, QVector<LineStruct> *lineDetails, qint32 lineToProcess,
                                        bool isCalledByRecursion);
     void handleBadLine(QVector<LineStruct> *lineDetails, qint32 lineToProcess);
@@ -189,7 +206,6 @@ private:
     inline quint16 ire_to_out(double_t ire);
     inline double_t peakdetect_quad(double_t *y);
 
-    inline double_t cubicInterpolate(quint16 *y, double_t x);
     inline void scale(quint16 *buf, double_t *outbuf, double_t start, double_t end, double_t outlen);
 
     inline bool inRange(double_t v, double_t l, double_t h);
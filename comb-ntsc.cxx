@@ -2,6 +2,11 @@
 
 #include "ld-decoder.h"
 #include "deemp.h"
+#include "workqueue.h"
+
+#include <map>
+#include <thread>
+#include <atomic>
 
 //#include <Eigen/Dense>
 //using namespace Eigen;
@@ -80,7 +85,7 @@ inline double IRE(double in)
 }
 
 struct YIQ {
-        double y, i, q;
+        sample_t y, i, q;
 
         YIQ(double _y = 0.0, double _i = 0.0, double _q = 0.0) {
                 y = _y; i = _i; q = _q;
@@ -170,12 +175,30 @@ const int out_x = 910;
 struct frame_t {
 	uint16_t rawbuffer[in_x * in_y];
 
-	double clpbuffer[3][in_y][in_x];
-	double combk[3][in_y][in_x];
+	sample_t clpbuffer[3][in_y][in_x];
+	sample_t combk[3][in_y][in_x];
 		
 	cline_t cbuf[in_y];
 };
 
+// rolling 1D comb rows for Comb::CombLine(), indexed by (line & 7)
+struct linecomb_t {
+	sample_t clp0[8][in_x];
+	sample_t k0[8][in_x];
+	sample_t zero[in_x];
+
+	int next1d;
+	double mse, me;
+};
+
+// one input frame on its way through the threaded pipeline (-j)
+struct comb_job_t {
+	long long seq;
+
+	uint16_t rawbuffer[in_x * in_y];
+	cline_t cbuf[in_y];
+};
+
 class Comb
 {
 	protected:
@@ -204,176 +227,253 @@ class Comb
 		cline_t tbuf[in_y];
 		cline_t pbuf[in_y], nbuf[in_y];
 
-		frame_t Frame[nframes];
+		// Frame[0] is the newest frame.  Process() rotates the pointers, the
+		// frames themselves never move.
+		frame_t framebuf[nframes];
+		frame_t *Frame[nframes];
+
+		linecomb_t lc;
 
 		Filter *f_hpy, *f_hpi, *f_hpq;
 		Filter *f_hpvy, *f_hpvi, *f_hpvq;
 
-		void FilterIQ(cline_t cbuf[in_y], int fnum) {
-			for (int l = 44; l < in_y; l++) {
-				//uint16_t *line = &Frame[fnum].rawbuffer[l * in_x];	
-				//bool invertphase = (line[0] == 16384);
+		struct outframe_t {
+			uint16_t *buf;
+			int owidth, fnum;
+		};
 
-				Filter f_i(f_colorlpf_hq ? f_colorlpi : f_colorlpi);
-				Filter f_q(f_colorlpf_hq ? f_colorlpi : f_colorlpq);
+		WorkQueue<outframe_t> *writeq;
+		std::thread writer;
 
-				int qoffset = 2; // f_colorlpf_hq ? f_colorlpi_offset : f_colorlpq_offset;
+		// -j: spreads the lines of the frame path's stages over threads
+		WorkPool *pool;
 
-				double filti = 0, filtq = 0;
+		// Runs fn(l) for firstline <= l < lastline, across the pool if there is one
+		void ForLines(int firstline, int lastline, const std::function<void(int)> &fn) {
+			if (pool) {
+				pool->run(firstline, lastline, fn);
+				return;
+			}
 
-				for (int h = 4; h < 840; h++) {
-					int phase = h % 4;
-					
-					switch (phase) {
-						case 0: filti = f_i.feed(cbuf[l].p[h].i); break;
-						case 1: filtq = f_q.feed(cbuf[l].p[h].q); break;
-						case 2: filti = f_i.feed(cbuf[l].p[h].i); break;
-						case 3: filtq = f_q.feed(cbuf[l].p[h].q); break;
-						default: break;
-					}
+			for (int l = firstline; l < lastline; l++) {
+				fn(l);
+			}
+		}
 
-					if (l == (f_debugline + 25)) {
-						cerr << "IQF " << h << ' ' << cbuf[l].p[h - f_colorlpi_offset].i << ' ' << filti << ' ' << cbuf[l].p[h - qoffset].q << ' ' << filtq << endl;
-					}
+		// Most stages below are split into a per-line kernel and a whole-frame
+		// loop over it.  The kernels are shared with ProcessLines(), which
+		// runs -d 1/-d 2 a line at a time.
 
-					cbuf[l].p[h - qoffset].i = filti; 
-					cbuf[l].p[h - qoffset].q = filtq; 
+		void FilterIQLine(cline_t *cl, int l) {
+			sf_colorlpi_t f_i(cs_colorlpi_b, cs_colorlpi_a);
+			sf_colorlpq_t f_q(f_colorlpf_hq ? cs_colorlpi_b : cs_colorlpq_b, f_colorlpf_hq ? cs_colorlpi_a : cs_colorlpq_a);
+
+			int qoffset = 2; // f_colorlpf_hq ? f_colorlpi_offset : f_colorlpq_offset;
+
+			double filti = 0, filtq = 0;
+
+			// gather the I and Q samples and run each filter over the whole line at once
+			double ibuf[in_x], qbuf[in_x];
+			int ni = 0, nq = 0;
+
+			for (int h = 4; h < 840; h++) {
+				if (h % 2) qbuf[nq++] = cl->p[h].q;
+				else ibuf[ni++] = cl->p[h].i;
+			}
+
+			f_i.feed(ibuf, ibuf, ni);
+			f_q.feed(qbuf, qbuf, nq);
+			ni = nq = 0;
+
+			for (int h = 4; h < 840; h++) {
+				int phase = h % 4;
+				
+				switch (phase) {
+					case 0: filti = ibuf[ni++]; break;
+					case 1: filtq = qbuf[nq++]; break;
+					case 2: filti = ibuf[ni++]; break;
+					case 3: filtq = qbuf[nq++]; break;
+					default: break;
 				}
+
+				if (l == (f_debugline + 25)) {
+					cerr << "IQF " << h << ' ' << cl->p[h - f_colorlpi_offset].i << ' ' << filti << ' ' << cl->p[h - qoffset].q << ' ' << filtq << endl;
+				}
+
+				cl->p[h - qoffset].i = filti; 
+				cl->p[h - qoffset].q = filtq; 
 			}
 		}
+
+		void FilterIQ(cline_t cbuf[in_y], int fnum) {
+			ForLines(44, in_y, [&](int l) {
+				FilterIQLine(&cbuf[l], l);
+			});
+		}
 	
 		// precompute 1D comb filter, used as a fallback for edges 
-		void Split1D(int fnum)
+		void Split1DLine(uint16_t *line, sample_t *clp0, sample_t *k0, int l)
 		{
-			for (int l = 44; l < in_y; l++) {
-				uint16_t *line = &Frame[fnum].rawbuffer[l * in_x];	
-				bool invertphase = (line[0] == 16384);
+			bool invertphase = (line[0] == 16384);
 
-				if (f_phaseinvert) invertphase = !invertphase;
+			if (f_phaseinvert) invertphase = !invertphase;
 
-				Filter f_1di(f_colorlpi);
-				Filter f_1dq(f_colorlpq);
-				int f_toffset = 16;
+			sf_colorlpi_t f_1di(cs_colorlpi_b, cs_colorlpi_a);
+			sf_colorlpq_t f_1dq(cs_colorlpq_b, cs_colorlpq_a);
+			int f_toffset = 16;
 
-				for (int h = 4; h < 840; h++) {
-					int phase = h % 4;
-					double tc1 = (((line[h + 2] + line[h - 2]) / 2) - line[h]); 
-					double tc1f = 0, tsi = 0, tsq = 0;
+			// first pass computes the comb and the I/Q filter inputs, which are
+			// then filtered a whole line at a time
+			double tc1buf[in_x];
+			double ibuf[in_x], qbuf[in_x];
+			int ni = 0, nq = 0;
 
-					if (!invertphase) tc1 = -tc1;
-						
-					switch (phase) {
-						case 0: tsi = tc1; tc1f = f_1di.feed(tsi); break;
-						case 1: tsq = -tc1; tc1f = -f_1dq.feed(tsq); break;
-						case 2: tsi = -tc1; tc1f = -f_1di.feed(tsi); break;
-						case 3: tsq = tc1; tc1f = f_1dq.feed(tsq); break;
-						default: break;
-					}
-						
-					if (!invertphase) {
-						tc1 = -tc1;
-						tc1f = -tc1f;
-					}
+			for (int h = 4; h < 840; h++) {
+				int phase = h % 4;
+				double tc1 = (((line[h + 2] + line[h - 2]) / 2) - line[h]); 
 
-					Frame[fnum].clpbuffer[0][l][h] = tc1;
-					if (dim == 1) Frame[fnum].clpbuffer[0][l][h - f_toffset] = tc1f;
+				tc1buf[h] = tc1;
 
-					Frame[fnum].combk[0][l][h] = 1;
+				if (!invertphase) tc1 = -tc1;
+					
+				switch (phase) {
+					case 0: ibuf[ni++] = tc1; break;
+					case 1: qbuf[nq++] = -tc1; break;
+					case 2: ibuf[ni++] = -tc1; break;
+					case 3: qbuf[nq++] = tc1; break;
+					default: break;
+				}
+			}
 
-					if (l == (f_debugline + 25)) {
-						cerr << h << ' ' << line[h - 4] << ' ' << line[h - 2] << ' ' << line[h] << ' ' << line[h + 2] << ' ' << line[h + 4] << ' ' << tc1 << ' ' << Frame[fnum].clpbuffer[0][l][h - f_toffset] << endl;
-					}
+			f_1di.feed(ibuf, ibuf, ni);
+			f_1dq.feed(qbuf, qbuf, nq);
+			ni = nq = 0;
+
+			for (int h = 4; h < 840; h++) {
+				int phase = h % 4;
+				double tc1 = tc1buf[h];
+				double tc1f = 0;
+
+				switch (phase) {
+					case 0: tc1f = ibuf[ni++]; break;
+					case 1: tc1f = -qbuf[nq++]; break;
+					case 2: tc1f = -ibuf[ni++]; break;
+					case 3: tc1f = qbuf[nq++]; break;
+					default: break;
+				}
+					
+				if (!invertphase) {
+					tc1f = -tc1f;
+				}
+
+				clp0[h] = tc1;
+				// (the first few land left of the line and are never read)
+				if ((dim == 1) && (h >= f_toffset)) clp0[h - f_toffset] = tc1f;
+
+				k0[h] = 1;
+
+				if ((l == (f_debugline + 25)) && (h >= f_toffset)) {
+					cerr << h << ' ' << line[h - 4] << ' ' << line[h - 2] << ' ' << line[h] << ' ' << line[h + 2] << ' ' << line[h + 4] << ' ' << tc1 << ' ' << clp0[h - f_toffset] << endl;
 				}
 			}
 		}
+
+		void Split1D(int fnum)
+		{
+			ForLines(44, in_y, [&](int l) {
+				Split1DLine(&Frame[fnum]->rawbuffer[l * in_x], Frame[fnum]->clpbuffer[0][l], Frame[fnum]->combk[0][l], l);
+			});
+		}
 	
 		int rawbuffer_val(int fr, int x, int y) {
-			return Frame[fr].rawbuffer[(y * in_x) + x];
+			return Frame[fr]->rawbuffer[(y * in_x) + x];
 		}
 	
-		void Split2D(int f) 
+		// clp1/k1/k0 are written, k2 (the 3D weights) is only read
+		void Split2DLine(uint16_t *raw, sample_t *p1line, sample_t *c1line, sample_t *n1line, sample_t *clp1, sample_t *k0, sample_t *k1, sample_t *k2, int l)
 		{
-			for (int l = 36; l < in_y; l++) {
-				uint16_t *pline = &Frame[f].rawbuffer[(l - 2) * in_x];	
-				uint16_t *line = &Frame[f].rawbuffer[l * in_x];	
-				uint16_t *nline = &Frame[f].rawbuffer[(l + 2) * in_x];	
-		
-				double *p1line = Frame[f].clpbuffer[0][l - 2];
-				double *c1line = Frame[f].clpbuffer[0][l];
-				double *n1line = Frame[f].clpbuffer[0][l + 2];
-		
-				// 2D filtering.  can't do top or bottom line - calced between 1d and 3d because this is
-				// filtered 
-				if ((l >= 4) && (l < 524)) {
-					for (int h = 18; h < 840; h++) {
-						double tc1;
-					
-						double kp, kn;
+			// 2D filtering.  can't do top or bottom line - calced between 1d and 3d because this is
+			// filtered 
+			if ((l >= 4) && (l < 524)) {
+				for (int h = 18; h < 840; h++) {
+					double tc1;
+				
+					double kp, kn;
 
-						kp  = fabs(fabs(c1line[h]) - fabs(p1line[h])); // - fabs(c1line[h] * .20);
-						kp += fabs(fabs(c1line[h - 1]) - fabs(p1line[h - 1])); 
-						kp -= (fabs(c1line[h]) + fabs(c1line[h - 1])) * .10;
-						kn  = fabs(fabs(c1line[h]) - fabs(n1line[h])); // - fabs(c1line[h] * .20);
-						kn += fabs(fabs(c1line[h - 1]) - fabs(n1line[h - 1])); 
-						kn -= (fabs(c1line[h]) + fabs(n1line[h - 1])) * .10;
+					kp  = fabs(fabs(c1line[h]) - fabs(p1line[h])); // - fabs(c1line[h] * .20);
+					kp += fabs(fabs(c1line[h - 1]) - fabs(p1line[h - 1])); 
+					kp -= (fabs(c1line[h]) + fabs(c1line[h - 1])) * .10;
+					kn  = fabs(fabs(c1line[h]) - fabs(n1line[h])); // - fabs(c1line[h] * .20);
+					kn += fabs(fabs(c1line[h - 1]) - fabs(n1line[h - 1])); 
+					kn -= (fabs(c1line[h]) + fabs(n1line[h - 1])) * .10;
 
-						kp /= 2;
-						kn /= 2;
+					kp /= 2;
+					kn /= 2;
 
-						p_2drange = 45 * irescale;
-						kp = clamp(1 - (kp / p_2drange), 0, 1);
-						kn = clamp(1 - (kn / p_2drange), 0, 1);
+					kp = clamp(1 - (kp / p_2drange), 0, 1);
+					kn = clamp(1 - (kn / p_2drange), 0, 1);
 
-						if (!f_adaptive2d) kn = kp = 1.0;
+					if (!f_adaptive2d) kn = kp = 1.0;
 
-						double sc = 1.0;
+					double sc = 1.0;
 
-						if (kn || kp) {	
-							if (kn > (3 * kp)) kp = 0;
-							else if (kp > (3 * kn)) kn = 0;
+					if (kn || kp) {	
+						if (kn > (3 * kp)) kp = 0;
+						else if (kp > (3 * kn)) kn = 0;
 
-							sc = (2.0 / (kn + kp));// * max(kn * kn, kp * kp);
-							if (sc < 1.0) sc = 1.0;
-						} else {
-							if ((fabs(fabs(p1line[h]) - fabs(n1line[h])) - fabs((n1line[h] + p1line[h]) * .2)) <= 0) {
-								kn = kp = 1;
-							}
+						sc = (2.0 / (kn + kp));// * max(kn * kn, kp * kp);
+						if (sc < 1.0) sc = 1.0;
+					} else {
+						if ((fabs(fabs(p1line[h]) - fabs(n1line[h])) - fabs((n1line[h] + p1line[h]) * .2)) <= 0) {
+							kn = kp = 1;
 						}
-						
+					}
+					
+
+					tc1  = ((c1line[h] - p1line[h]) * kp * sc);
+					tc1 += ((c1line[h] - n1line[h]) * kn * sc);
+					tc1 /= (2 * 2);
 
-						tc1  = ((Frame[f].clpbuffer[0][l][h] - p1line[h]) * kp * sc);
-						tc1 += ((Frame[f].clpbuffer[0][l][h] - n1line[h]) * kn * sc);
-						tc1 /= (2 * 2);
+					if (l == (f_debugline + 25)) {
+						uint16_t *pline = &raw[(l - 2) * in_x];	
+						uint16_t *line = &raw[l * in_x];	
+						uint16_t *nline = &raw[(l + 2) * in_x];	
 
-						if (l == (f_debugline + 25)) {
-							//cerr << "2D " << h << ' ' << clpbuffer[l][h] << ' ' << p1line[h] << ' ' << n1line[h] << endl;
-							cerr << "2D " << h << ' ' << ' ' << sc << ' ' << kp << ' ' << kn << ' ' << (pline[h]) << '|' << (p1line[h]) << ' ' << (line[h]) << '|' << (Frame[f].clpbuffer[0][l][h]) << ' ' << (nline[h]) << '|' << (n1line[h]) << " OUT " << (tc1) << endl;
-						}	
+						//cerr << "2D " << h << ' ' << clpbuffer[l][h] << ' ' << p1line[h] << ' ' << n1line[h] << endl;
+						cerr << "2D " << h << ' ' << ' ' << sc << ' ' << kp << ' ' << kn << ' ' << (pline[h]) << '|' << (p1line[h]) << ' ' << (line[h]) << '|' << (c1line[h]) << ' ' << (nline[h]) << '|' << (n1line[h]) << " OUT " << (tc1) << endl;
+					}	
 
-						Frame[f].clpbuffer[1][l][h] = tc1;
-						Frame[f].combk[1][l][h] = 1.0; // (sc * (kn + kp)) / 2.0;
-					}
+					clp1[h] = tc1;
+					k1[h] = 1.0; // (sc * (kn + kp)) / 2.0;
 				}
+			}
 
-				for (int h = 4; h < 840; h++) {
-					if ((l >= 2) && (l <= 523)) {
-						Frame[f].combk[1][l][h] *= 1 - Frame[f].combk[2][l][h];
-					}
-					
-					// 1D 
-					Frame[f].combk[0][l][h] = 1 - Frame[f].combk[2][l][h] - Frame[f].combk[1][l][h];
+			for (int h = 4; h < 840; h++) {
+				if ((l >= 2) && (l <= 523)) {
+					k1[h] *= 1 - k2[h];
 				}
-			}	
+				
+				// 1D 
+				k0[h] = 1 - k2[h] - k1[h];
+			}
+		}
+
+		void Split2D(int f) 
+		{
+			ForLines(36, in_y, [&](int l) {
+				Split2DLine(Frame[f]->rawbuffer, Frame[f]->clpbuffer[0][l - 2], Frame[f]->clpbuffer[0][l], Frame[f]->clpbuffer[0][l + 2],
+					    Frame[f]->clpbuffer[1][l], Frame[f]->combk[0][l], Frame[f]->combk[1][l], Frame[f]->combk[2][l], l);
+			});
 		}	
 
 		void Split3D(int f, bool opt_flow = false) 
 		{
-			for (int l = 36; l < in_y; l++) {
-				uint16_t *line = &Frame[f].rawbuffer[l * in_x];	
+			ForLines(36, in_y, [&](int l) {
+				uint16_t *line = &Frame[f]->rawbuffer[l * in_x];	
 		
 				// shortcuts for previous/next 1D/pixel lines	
-				uint16_t *p3line = &Frame[0].rawbuffer[l * in_x];	
-				uint16_t *n3line = &Frame[2].rawbuffer[l * in_x];	
+				uint16_t *p3line = &Frame[0]->rawbuffer[l * in_x];	
+				uint16_t *n3line = &Frame[2]->rawbuffer[l * in_x];	
 		
 				// a = fir1(16, 0.1); printf("%.15f, ", a)
 				Filter lp_3d({0.005719569452904, 0.009426612841315, 0.019748592575455, 0.036822680065252, 0.058983880135427, 0.082947830292278, 0.104489989820068, 0.119454688318951, 0.124812312996699, 0.119454688318952, 0.104489989820068, 0.082947830292278, 0.058983880135427, 0.036822680065252, 0.019748592575455, 0.009426612841315, 0.005719569452904}, {1.0});
@@ -383,8 +483,8 @@ class Comb
 				for (int h = 4; (dim >= 3) && (h < 840); h++) {
 					int adr = (l * in_x) + h;
 
-					double __k = abs(Frame[0].rawbuffer[adr] - Frame[2].rawbuffer[adr]); 
-					__k += abs((Frame[1].rawbuffer[adr] - Frame[2].rawbuffer[adr]) - (Frame[1].rawbuffer[adr] - Frame[0].rawbuffer[adr])); 
+					double __k = abs(Frame[0]->rawbuffer[adr] - Frame[2]->rawbuffer[adr]); 
+					__k += abs((Frame[1]->rawbuffer[adr] - Frame[2]->rawbuffer[adr]) - (Frame[1]->rawbuffer[adr] - Frame[0]->rawbuffer[adr])); 
 
 					if (h > 12) _k[h - 8] = lp_3d.feed(__k);
 					if (h >= 836) _k[h] = __k;
@@ -392,89 +492,101 @@ class Comb
 	
 				for (int h = 4; h < 840; h++) {
 					if (opt_flow) {
-						Frame[f].clpbuffer[2][l][h] = (p3line[h] - line[h]); 
+						Frame[f]->clpbuffer[2][l][h] = (p3line[h] - line[h]); 
 					} else {
-						Frame[f].clpbuffer[2][l][h] = (((p3line[h] + n3line[h]) / 2) - line[h]); 
-						Frame[f].combk[2][l][h] = clamp(1 - ((_k[h] - (p_3dcore)) / p_3drange), 0, 1);
+						Frame[f]->clpbuffer[2][l][h] = (((p3line[h] + n3line[h]) / 2) - line[h]); 
+						Frame[f]->combk[2][l][h] = clamp(1 - ((_k[h] - (p_3dcore)) / p_3drange), 0, 1);
 					}
 					if (l == (f_debugline + 25)) {
 //						cerr << "3DC " << h << ' ' << k2 << ' ' << adj << ' ' << k[h] << endl;
 					}
 				
 					if ((l >= 2) && (l <= 523)) {
-						Frame[f].combk[1][l][h] = 1 - Frame[f].combk[2][l][h];
+						Frame[f]->combk[1][l][h] = 1 - Frame[f]->combk[2][l][h];
 					}
 					
 					// 1D 
-					Frame[f].combk[0][l][h] = 1 - Frame[f].combk[2][l][h] - Frame[f].combk[1][l][h];
+					Frame[f]->combk[0][l][h] = 1 - Frame[f]->combk[2][l][h] - Frame[f]->combk[1][l][h];
 				}
-			}	
+			});
 		}	
 
-		void SplitIQ(int f) {
-			double mse = 0.0;
-			double me = 0.0;
+		// clp[] and k[] are the 1D/2D/3D rows for line l.  msel/sel collect the
+		// -D error stats.
+		void SplitIQLine(uint16_t *line, sample_t *clp[3], sample_t *k[3], cline_t *cl, int l, double &msel, double &sel) {
+			bool invertphase = (line[0] == 16384);
+			
+			if (f_phaseinvert) invertphase = !invertphase;
 
-			memset(Frame[f].cbuf, 0, sizeof(cline_t) * in_y); 
+//			if (f_neuralnet) invertphase = true;
 
-			for (int l = 36; l < in_y; l++) {
-				double msel = 0.0, sel = 0.0;
-				uint16_t *line = &Frame[f].rawbuffer[l * in_x];	
-				bool invertphase = (line[0] == 16384);
+			double si = 0, sq = 0;
+			for (int h = 4; h < 840; h++) {
+				int phase = h % 4;
+				double cavg = 0;
+
+				cavg += (clp[2][h] * k[2][h]);
+				cavg += (clp[1][h] * k[1][h]);
+				cavg += (clp[0][h] * k[0][h]);
+
+				cavg /= 2;
 				
-				if (f_phaseinvert) invertphase = !invertphase;
+				if (f_debug2d) {
+					cavg = clp[1][h] - clp[2][h];
+					msel += (cavg * cavg);
+					sel += fabs(cavg);
 
-//				if (f_neuralnet) invertphase = true;
+					if (l == (f_debugline + 25)) {
+						cerr << "D2D " << h << ' ' << clp[1][h] << ' ' << clp[2][h] << ' ' << cavg << endl;
+					}
+				}
 
-				double si = 0, sq = 0;
-				for (int h = 4; h < 840; h++) {
-					int phase = h % 4;
-					double cavg = 0;
+				if (!invertphase) cavg = -cavg;
 
-					cavg += (Frame[f].clpbuffer[2][l][h] * Frame[f].combk[2][l][h]);
-					cavg += (Frame[f].clpbuffer[1][l][h] * Frame[f].combk[1][l][h]);
-					cavg += (Frame[f].clpbuffer[0][l][h] * Frame[f].combk[0][l][h]);
+				switch (phase) {
+					case 0: si = cavg; break;
+					case 1: sq = -cavg; break;
+					case 2: si = -cavg; break;
+					case 3: sq = cavg; break;
+					default: break;
+				}
 
-					cavg /= 2;
-					
-					if (f_debug2d) {
-						cavg = Frame[f].clpbuffer[1][l][h] - Frame[f].clpbuffer[2][l][h];
-						msel += (cavg * cavg);
-						sel += fabs(cavg);
+				cl->p[h].y = line[h]; 
+				if (f_debug2d) cl->p[h].y = ire_to_u16(50); 
+				cl->p[h].i = si;  
+				cl->p[h].q = sq; 
+				
+//				if (l == 240 ) {
+//					cerr << h << ' ' << k[1][h] << ' ' << k[0][h] << ' ' << cl->p[h].y << ' ' << si << ' ' << sq << endl;
+//				}
 
-						if (l == (f_debugline + 25)) {
-							cerr << "D2D " << h << ' ' << Frame[f].clpbuffer[1][l][h] << ' ' << Frame[f].clpbuffer[2][l][h] << ' ' << cavg << endl;
-						}
-					}
+				if (f_bw) {
+					cl->p[h].i = cl->p[h].q = 0;  
+				}
+			}
+		}
 
-					if (!invertphase) cavg = -cavg;
+		void SplitIQ(int f) {
+			double mse = 0.0;
+			double me = 0.0;
 
-					switch (phase) {
-						case 0: si = cavg; break;
-						case 1: sq = -cavg; break;
-						case 2: si = -cavg; break;
-						case 3: sq = cavg; break;
-						default: break;
-					}
+			double msel[in_y], sel[in_y];
 
-					Frame[f].cbuf[l].p[h].y = line[h]; 
-					if (f_debug2d) Frame[f].cbuf[l].p[h].y = ire_to_u16(50); 
-					Frame[f].cbuf[l].p[h].i = si;  
-					Frame[f].cbuf[l].p[h].q = sq; 
-					
-//					if (l == 240 ) {
-//						cerr << h << ' ' << Frame[f].combk[1][l][h] << ' ' << Frame[f].combk[0][l][h] << ' ' << Frame[f].cbuf[l].p[h].y << ' ' << si << ' ' << sq << endl;
-//					}
+			memset(Frame[f]->cbuf, 0, sizeof(cline_t) * in_y); 
 
-					if (f_bw) {
-						Frame[f].cbuf[l].p[h].i = Frame[f].cbuf[l].p[h].q = 0;  
-					}
-				}
+			ForLines(36, in_y, [&](int l) {
+				sample_t *clp[3] = {Frame[f]->clpbuffer[0][l], Frame[f]->clpbuffer[1][l], Frame[f]->clpbuffer[2][l]};
+				sample_t *k[3] = {Frame[f]->combk[0][l], Frame[f]->combk[1][l], Frame[f]->combk[2][l]};
 
-				if (f_debug2d && (l >= 6) && (l <= 523)) {
-					cerr << l << ' ' << msel / (840 - 4) << " ME " << sel / (840 - 4) << endl; 
-					mse += msel / (840 - 4);
-					me += sel / (840 - 4);
+				msel[l] = sel[l] = 0.0;
+				SplitIQLine(&Frame[f]->rawbuffer[l * in_x], clp, k, &Frame[f]->cbuf[l], l, msel[l], sel[l]);
+			});
+
+			for (int l = 36; f_debug2d && (l < in_y); l++) {
+				if ((l >= 6) && (l <= 523)) {
+					cerr << l << ' ' << msel[l] / (840 - 4) << " ME " << sel[l] / (840 - 4) << endl; 
+					mse += msel[l] / (840 - 4);
+					me += sel[l] / (840 - 4);
 				}
 			}
 			if (f_debug2d) {
@@ -482,6 +594,43 @@ class Comb
 			}
 		}
 		
+		// f_hpi/f_hpq carry state from line to line, so lines have to be fed
+		// in order
+		void DoCNRLine(cline_t *input) {
+			double hplinei[in_x + 32], hplineq[in_x + 32];
+
+			memset(hplinei, 0, sizeof(hplinei));
+			memset(hplineq, 0, sizeof(hplineq));
+
+			for (int h = 60; h <= 842; h++) {
+				hplinei[h] = input->p[h].i;
+				hplineq[h] = input->p[h].q;
+			}
+			f_hpi->feed(&hplinei[60], &hplinei[60], 842 - 60 + 1);
+			f_hpq->feed(&hplineq[60], &hplineq[60], 842 - 60 + 1);
+			
+			for (int h = 60; h < 842; h++) {
+				double ai = hplinei[h + 12];
+				double aq = hplineq[h + 12];
+
+//				if (l == (f_debugline + 25)) {
+//					cerr << "NR " << h << ' ' << input->p[h].y << ' ' << hplinef[h + 12].y << ' ' << ' ' << a << ' ' << endl;
+//				}
+
+				if (fabs(ai) > nr_c) {
+					ai = (ai > 0) ? nr_c : -nr_c;
+				}
+				
+				if (fabs(aq) > nr_c) {
+					aq = (aq > 0) ? nr_c : -nr_c;
+				}
+
+				input->p[h].i -= ai;
+				input->p[h].q -= aq;
+//				if (l == (f_debugline + 25)) cerr << a << ' ' << input->p[h].y << endl; 
+			}
+		}
+
 		void DoCNR(int f, cline_t cbuf[in_y], double min = -1.0) {
 			int firstline = (linesout == in_y) ? 20 : 38;
 	
@@ -489,37 +638,37 @@ class Comb
 			if (nr_c <= 0) return;
 
 			for (int l = firstline; l < in_y; l++) {
-				YIQ hplinef[in_x + 32];
-				cline_t *input = &cbuf[l];
+				DoCNRLine(&cbuf[l]);
+			}
+		}
+					
+		// as with DoCNRLine, f_hpy needs lines in order
+		void DoYNRLine(cline_t *input, int l) {
+			double hplinef[in_x + 32];
 
-				for (int h = 60; h <= 842; h++) {
-					hplinef[h].i = f_hpi->feed(input->p[h].i);
-					hplinef[h].q = f_hpq->feed(input->p[h].q);
-				}
-				
-				for (int h = 60; h < 842; h++) {
-					double ai = hplinef[h + 12].i;
-					double aq = hplinef[h + 12].q;
+			memset(hplinef, 0, sizeof(hplinef));
 
-//					if (l == (f_debugline + 25)) {
-//						cerr << "NR " << h << ' ' << input->p[h].y << ' ' << hplinef[h + 12].y << ' ' << ' ' << a << ' ' << endl;
-//					}
+			for (int h = 40; h <= 843; h++) {
+				hplinef[h] = input->p[h].y;
+			}
+			f_hpy->feed(&hplinef[40], &hplinef[40], 843 - 40 + 1);
+			
+			for (int h = 40; h < 843; h++) {
+				double a = hplinef[h + 12];
 
-					if (fabs(ai) > nr_c) {
-						ai = (ai > 0) ? nr_c : -nr_c;
-					}
-					
-					if (fabs(aq) > nr_c) {
-						aq = (aq > 0) ? nr_c : -nr_c;
-					}
+				if (l == (f_debugline + 25)) {
+					cerr << "NR " << l << ' ' << h << ' ' << input->p[h].y << ' ' << hplinef[h + 12] << ' ' << ' ' << a << ' ' << endl;
+				}
 
-					input->p[h].i -= ai;
-					input->p[h].q -= aq;
-//					if (l == (f_debugline + 25)) cerr << a << ' ' << input->p[h].y << endl; 
+				if (fabs(a) > nr_y) {
+					a = (a > 0) ? nr_y : -nr_y;
 				}
+
+				input->p[h].y -= a;
+				if (l == (f_debugline + 25)) cerr << a << ' ' << input->p[h].y << endl; 
 			}
 		}
-					
+
 		void DoYNR(int f, cline_t cbuf[in_y], double min = -1.0) {
 			int firstline = (linesout == in_y) ? 20 : 38;
 
@@ -528,75 +677,75 @@ class Comb
 			if (nr_y <= 0) return;
 
 			for (int l = firstline; l < in_y; l++) {
-				YIQ hplinef[in_x + 32];
-				cline_t *input = &cbuf[l];
-
-				for (int h = 40; h <= 843; h++) {
-					hplinef[h].y = f_hpy->feed(input->p[h].y);
-				}
-				
-				for (int h = 40; h < 843; h++) {
-					double a = hplinef[h + 12].y;
-
-					if (l == (f_debugline + 25)) {
-						cerr << "NR " << l << ' ' << h << ' ' << input->p[h].y << ' ' << hplinef[h + 12].y << ' ' << ' ' << a << ' ' << endl;
-					}
-
-					if (fabs(a) > nr_y) {
-						a = (a > 0) ? nr_y : -nr_y;
-					}
-
-					input->p[h].y -= a;
-					if (l == (f_debugline + 25)) cerr << a << ' ' << input->p[h].y << endl; 
-				}
+				DoYNRLine(&cbuf[l], l);
 			}
 		}
 		
-		void ToRGB(int f, int firstline, cline_t cbuf[in_y]) {
-			// YIQ (YUV?) -> RGB conversion	
-			for (int l = firstline; l < in_y; l++) {
-				double burstlev = Frame[f].rawbuffer[(l * in_x) + 1] / irescale;
-				uint16_t *line_output = &output[(out_x * 3 * (l - firstline))];
-				int o = 0;
+		// aburstlev is a running average down (and across) frames, so this
+		// has to be called for each line in order.  Returns the level to use
+		// for line l.
+		double BurstLevel(uint16_t *raw, int l) {
+			double burstlev = raw[(l * in_x) + 1] / irescale;
+
+			if (burstlev > 3) {
+				if (aburstlev < 0) aburstlev = burstlev;	
+				aburstlev = (aburstlev * .99) + (burstlev * .01);
+			}
+//			cerr << "burst level " << burstlev << " mavg " << aburstlev << ' ' << 10 / aburstlev << ' ' << endl;
 
-				if (burstlev > 3) {
-					if (aburstlev < 0) aburstlev = burstlev;	
-					aburstlev = (aburstlev * .99) + (burstlev * .01);
-				}
-//				cerr << "burst level " << burstlev << " mavg " << aburstlev << ' ' << 10 / aburstlev << ' ' << endl;
+			return aburstlev;
+		}
 
-				for (int h = 0; h < 910; h++) {
-					RGB r;
-					YIQ yiq = cbuf[l].p[h + 0];
+		// showk is the combk row to display for -k, or NULL
+		void ToRGBLine(sample_t *showk, int l, int firstline, cline_t *cl, double aburstlev) {
+			uint16_t *line_output = &output[(out_x * 3 * (l - firstline))];
+			int o = 0;
 
-					yiq.i *= (10 / aburstlev);
-					yiq.q *= (10 / aburstlev);
+			for (int h = 0; h < 910; h++) {
+				RGB r;
+				YIQ yiq = cl->p[h + 0];
 
-					if (f_showk) {
-						yiq.y = ire_to_u16(Frame[f].combk[dim - 1][l][h + 82] * 100);
-//						yiq.y = ire_to_u16(((double)h / 752.0) * 100);
-						yiq.i = yiq.q = 0;
-					}
+				yiq.i *= (10 / aburstlev);
+				yiq.q *= (10 / aburstlev);
 
-					if (l == (f_debugline + 25)) {
-						cerr << "YIQ " << h << ' ' << atan2deg(yiq.q, yiq.i) << ' ' << yiq.y << ' ' << yiq.i << ' ' << yiq.q << endl;
-					}
+				if (showk) {
+					yiq.y = ire_to_u16(showk[h + 82] * 100);
+//					yiq.y = ire_to_u16(((double)h / 752.0) * 100);
+					yiq.i = yiq.q = 0;
+				}
 
-					cline = l;
-					r.conv(yiq);
-					
-					if (l == (f_debugline + 25)) {
-						cerr << "RGB " << r.r << ' ' << r.g << ' ' << r.b << endl ;
-						r.r = r.g = r.b = 0;
-					}
-	
-					line_output[o++] = (uint16_t)(r.r); 
-					line_output[o++] = (uint16_t)(r.g); 
-					line_output[o++] = (uint16_t)(r.b); 
+				if (l == (f_debugline + 25)) {
+					cerr << "YIQ " << h << ' ' << atan2deg(yiq.q, yiq.i) << ' ' << yiq.y << ' ' << yiq.i << ' ' << yiq.q << endl;
+				}
+
+				r.conv(yiq);
+				
+				if (l == (f_debugline + 25)) {
+					cerr << "RGB " << r.r << ' ' << r.g << ' ' << r.b << endl ;
+					r.r = r.g = r.b = 0;
 				}
+	
+				line_output[o++] = (uint16_t)(r.r); 
+				line_output[o++] = (uint16_t)(r.g); 
+				line_output[o++] = (uint16_t)(r.b); 
 			}
 		}
 
+		void ToRGB(int f, int firstline, cline_t cbuf[in_y]) {
+			double burstlev[in_y];
+
+			// the burst level average is worked out for the whole frame
+			// first, then lines can be converted in any order
+			for (int l = firstline; l < in_y; l++) {
+				burstlev[l] = BurstLevel(Frame[f]->rawbuffer, l);
+			}
+
+			// YIQ (YUV?) -> RGB conversion	
+			ForLines(firstline, in_y, [&](int l) {
+				ToRGBLine(f_showk ? Frame[f]->combk[dim - 1][l] : NULL, l, firstline, &cbuf[l], burstlev[l]);
+			});
+		}
+
 		void OpticalFlow3D(cline_t cbuf[in_y]) {
 			static Mat prev[2];
 			static Mat flow[2];	
@@ -642,8 +791,8 @@ class Comb
 						double c = (c1 < c2) ? c1 : c2;
 
 						// HACK:  This goes around a 1-frame delay	
-						Frame[1].combk[2][(y * 2)][70 + x] = c;
-						Frame[1].combk[2][(y * 2) + 1][70 + x] = c;
+						Frame[1]->combk[2][(y * 2)][70 + x] = c;
+						Frame[1]->combk[2][(y * 2) + 1][70 + x] = c;
 
 						uint16_t fm = clamp(c * 65535, 0, 65535);
 						flowmap[(y * 2)][0 + x] = fm;
@@ -689,6 +838,13 @@ class Comb
 			aburstlev = -1;
 
 			f_oddframe = false;	
+
+			writeq = NULL;
+			pool = NULL;
+
+			for (int i = 0; i < nframes; i++) {
+				Frame[i] = &framebuf[i];
+			}
 		
 			f_hpy = new Filter(f_nr);
 			f_hpi = new Filter(f_nrc);
@@ -701,7 +857,50 @@ class Comb
 			memset(output, 0, sizeof(output));
 		}
 
+		// With a writer thread running (see StartWriter()) WriteFrame() just
+		// queues a copy of the frame
 		void WriteFrame(uint16_t *obuf, int owidth = 910, int fnum = 0) {
+			if (writeq) {
+				outframe_t o;
+
+				o.buf = new uint16_t[owidth * linesout * 3];
+				o.owidth = owidth;
+				o.fnum = fnum;
+				memcpy(o.buf, obuf, owidth * linesout * 3 * 2);
+
+				writeq->push(o);
+				return;
+			}
+
+			WriteFrameOut(obuf, owidth, fnum);
+		}
+
+		void SetThreads(int nthreads) {
+			pool = new WorkPool(nthreads);
+		}
+
+		void StartWriter() {
+			writeq = new WorkQueue<outframe_t>(4);
+
+			writer = std::thread([this] {
+				outframe_t o;
+
+				while (writeq->pop(o)) {
+					WriteFrameOut(o.buf, o.owidth, o.fnum);
+					delete [] o.buf;
+				}
+			});
+		}
+
+		void StopWriter() {
+			writeq->close();
+			writer.join();
+
+			delete writeq;
+			writeq = NULL;
+		}
+
+		void WriteFrameOut(uint16_t *obuf, int owidth, int fnum) {
 			cerr << "WR" << fnum << endl;
 			if (!f_writeimages) {
 				if (!f_write8bit) {
@@ -732,40 +931,44 @@ class Comb
 			frames_out++;
 		}
 
-		void AdjustY(int f, cline_t cbuf[in_y]) {
-			int firstline = (linesout == in_y) ? 20 : 38;
-			// remove color data from baseband (Y)	
-			for (int l = firstline; l < in_y; l++) {
-				bool invertphase = (Frame[f].rawbuffer[l * in_x] == 16384);
-				if (f_phaseinvert) invertphase = !invertphase;
-
-				for (int h = 2; h < 842; h++) {
-					double comp;	
-					int phase = h % 4;
+		// remove color data from baseband (Y)	
+		void AdjustYLine(bool invertphase, cline_t *cl) {
+			for (int h = 2; h < 842; h++) {
+				double comp = 0;	
+				int phase = h % 4;
 
-					YIQ y = cbuf[l].p[h + 2];
+				YIQ y = cl->p[h + 2];
 
-					switch (phase) {
-						case 0: comp = y.i; break;
-						case 1: comp = -y.q; break;
-						case 2: comp = -y.i; break;
-						case 3: comp = y.q; break;
-						default: break;
-					}
+				switch (phase) {
+					case 0: comp = y.i; break;
+					case 1: comp = -y.q; break;
+					case 2: comp = -y.i; break;
+					case 3: comp = y.q; break;
+					default: break;
+				}
 
-					if (invertphase) comp = -comp;
-					y.y += comp;
+				if (invertphase) comp = -comp;
+				y.y += comp;
 
-					cbuf[l].p[h + 0] = y;
-				}
+				cl->p[h + 0] = y;
 			}
+		}
+
+		void AdjustY(int f, cline_t cbuf[in_y]) {
+			int firstline = (linesout == in_y) ? 20 : 38;
+			ForLines(firstline, in_y, [&](int l) {
+				bool invertphase = (Frame[f]->rawbuffer[l * in_x] == 16384);
+				if (f_phaseinvert) invertphase = !invertphase;
+
+				AdjustYLine(invertphase, &cbuf[l]);
+			});
 
 		}
 
 		void Proc3D_NoOF() {
-			memcpy(pbuf, Frame[0].cbuf, sizeof(pbuf));
-			memcpy(nbuf, Frame[1].cbuf, sizeof(pbuf));
-			memcpy(tbuf, Frame[2].cbuf, sizeof(pbuf));
+			memcpy(pbuf, Frame[0]->cbuf, sizeof(pbuf));
+			memcpy(nbuf, Frame[1]->cbuf, sizeof(pbuf));
+			memcpy(tbuf, Frame[2]->cbuf, sizeof(pbuf));
 				
 			// a = fir1(8, 0.1); printf("%.15f, ", a)
 			Filter lp_3dip({0.016282173233472, 0.046349864271587, 0.121506650149374, 0.199579915155249, 0.232562794380638, 0.199579915155249, 0.121506650149374, 0.046349864271587, 0.016282173233472}, {1.0});
@@ -774,9 +977,9 @@ class Comb
 			Filter lp_3dqn({0.016282173233472, 0.046349864271587, 0.121506650149374, 0.199579915155249, 0.232562794380638, 0.199579915155249, 0.121506650149374, 0.046349864271587, 0.016282173233472}, {1.0});
 
 			for (int y = 24; y < 525; y++) {
-				uint16_t *line = &Frame[1].rawbuffer[y * in_x];	
-				uint16_t *linep = &Frame[0].rawbuffer[y * in_x];	
-				uint16_t *linen = &Frame[2].rawbuffer[y * in_x];	
+				uint16_t *line = &Frame[1]->rawbuffer[y * in_x];	
+				uint16_t *linep = &Frame[0]->rawbuffer[y * in_x];	
+				uint16_t *linen = &Frame[2]->rawbuffer[y * in_x];	
 				bool invertphase = (line[0] == 16384);
 				if (f_phaseinvert) invertphase = !invertphase;
 
@@ -821,15 +1024,140 @@ class Comb
 						cerr << "3DC2 Y " << dy / irescale << ' ' << pbuf[y].p[x].y << ' ' << tbuf[y].p[x].y << ' ' << nbuf[y].p[x].y << endl;	
 						cerr << "3DC2 I " << di / irescale << ' ' << pbuf[y].p[x].i << ' ' << tbuf[y].p[x].i << ' ' << nbuf[y].p[x].i << endl;	
 						cerr << "3DC2 Q " << dq / irescale << ' ' << pbuf[y].p[x].q << ' ' << tbuf[y].p[x].q << ' ' << nbuf[y].p[x].q << endl;	
-						Frame[1].combk[2][y][x] = 1 - clamp(((diff / irescale) - 3) / 8, 0, 1);
-						cerr << x << ' ' << diff / irescale << ' ' << Frame[1].combk[2][y][x] << endl;
+						Frame[1]->combk[2][y][x] = 1 - clamp(((diff / irescale) - 3) / 8, 0, 1);
+						cerr << x << ' ' << diff / irescale << ' ' << Frame[1]->combk[2][y][x] << endl;
 					}
-					Frame[1].combk[2][y][x] = 1 - clamp(((diff / irescale) - 3) / 8, 0, 1);
+					Frame[1]->combk[2][y][x] = 1 - clamp(((diff / irescale) - 3) / 8, 0, 1);
 				}
 			}	
 
 		}
 		
+		// -d 1/-d 2 only ever look at l-2..l+2, so run the whole chain a line
+		// at a time instead of building the frame-sized clpbuffer/combk/cbuf
+		// planes.  Output is the same as the frame path.
+		//
+		// CombLine() is stateless from frame to frame (apart from lc, which is
+		// reset every frame) so frames can be combed on several threads, while
+		// FinishLine() has to see every line of every frame in order.
+		void CombLine(uint16_t *raw, int l, linecomb_t *lc, cline_t *row)
+		{
+			int firstline = (linesout == in_y) ? 20 : 38;
+			sample_t clp1[in_x], k1[in_x];
+
+			// the 1D comb runs two lines ahead of everything else
+			if (l == firstline) {
+				memset(lc->zero, 0, sizeof(lc->zero));
+				lc->next1d = firstline - 2;
+				lc->mse = lc->me = 0.0;
+			}
+
+			for (; lc->next1d <= (l + 2); lc->next1d++) {
+				int r = lc->next1d & 7;
+
+				memset(lc->clp0[r], 0, sizeof(lc->clp0[r]));
+				memset(lc->k0[r], 0, sizeof(lc->k0[r]));
+
+				if ((lc->next1d >= 44) && (lc->next1d < in_y)) {
+					Split1DLine(&raw[lc->next1d * in_x], lc->clp0[r], lc->k0[r], lc->next1d);
+				}
+			}
+
+			sample_t *clp[3] = {lc->clp0[l & 7], clp1, lc->zero};
+			sample_t *k[3] = {lc->k0[l & 7], k1, lc->zero};
+
+			memset(clp1, 0, sizeof(clp1));
+			memset(k1, 0, sizeof(k1));
+			memset(row, 0, sizeof(cline_t));
+
+			if (l >= 36) {
+				if (dim >= 2) {
+					// there's no line below the last one
+					sample_t *n1line = ((l + 2) < in_y) ? lc->clp0[(l + 2) & 7] : lc->zero;
+
+					Split2DLine(raw, lc->clp0[(l - 2) & 7], lc->clp0[l & 7], n1line, clp1, lc->k0[l & 7], k1, lc->zero, l);
+				}
+
+				double msel = 0.0, sel = 0.0;
+
+				SplitIQLine(&raw[l * in_x], clp, k, row, l, msel, sel);
+
+				if (f_debug2d && (l >= 6) && (l <= 523)) {
+					cerr << l << ' ' << msel / (840 - 4) << " ME " << sel / (840 - 4) << endl; 
+					lc->mse += msel / (840 - 4);
+					lc->me += sel / (840 - 4);
+				}
+			}
+
+			bool invertphase = (raw[l * in_x] == 16384);
+			if (f_phaseinvert) invertphase = !invertphase;
+
+			AdjustYLine(invertphase, row);
+			if (f_colorlpf && (l >= 44)) FilterIQLine(row, l);
+
+			// VBI - output line l carries input line l + 20 
+			if (l < 44 - 20) {
+				uint16_t *line = &raw[(l + 20) * in_x];	
+
+				for (int h = 4; h < 840; h++) {
+					row->p[h].y = line[h]; 
+				}
+			}
+		}
+
+		void FinishLine(uint16_t *raw, int l, cline_t *row)
+		{
+			int firstline = (linesout == in_y) ? 20 : 38;
+
+			if (nr_y > 0) DoYNRLine(row, l);
+			if (nr_c > 0) DoCNRLine(row);
+			ToRGBLine(NULL, l, firstline, row, BurstLevel(raw, l));
+		}
+
+		void ProcessLines(uint16_t *buffer)
+		{
+			int firstline = (linesout == in_y) ? 20 : 38;
+			cline_t row;
+
+			memcpy(Frame[0]->rawbuffer, buffer, (in_x * in_y * 2));
+
+			for (int l = firstline; l < in_y; l++) {
+				CombLine(Frame[0]->rawbuffer, l, &lc, &row);
+				FinishLine(Frame[0]->rawbuffer, l, &row);
+			}
+
+			if (f_debug2d) {
+				cerr << "TOTAL MSE " << lc.mse << " ME " << lc.me << endl;
+			}
+	
+			PostProcess(Frame[0]->rawbuffer);
+			framecount++;
+		}
+
+		// Threaded -d 1/-d 2: any number of threads can call CombJob() on
+		// different jobs, FinishJob() must be called in input order.
+		void CombJob(comb_job_t *job)
+		{
+			int firstline = (linesout == in_y) ? 20 : 38;
+			linecomb_t jlc;
+
+			for (int l = firstline; l < in_y; l++) {
+				CombLine(job->rawbuffer, l, &jlc, &job->cbuf[l]);
+			}
+		}
+
+		void FinishJob(comb_job_t *job)
+		{
+			int firstline = (linesout == in_y) ? 20 : 38;
+
+			for (int l = firstline; l < in_y; l++) {
+				FinishLine(job->rawbuffer, l, &job->cbuf[l]);
+			}
+
+			PostProcess(job->rawbuffer);
+			framecount++;
+		}
+
 		// buffer: in_xxin_y uint16_t array
 		void Process(uint16_t *buffer, int dim = 2)
 		{
@@ -838,11 +1166,27 @@ class Comb
 
 			cerr << "P " << f << ' ' << dim << endl;
 
-			memcpy(&Frame[2], &Frame[1], sizeof(frame_t));
-			memcpy(&Frame[1], &Frame[0], sizeof(frame_t));
-			memset(&Frame[0], 0, sizeof(frame_t));
+			// f_showk displays the per-frame combk planes, so it needs the frame
+			// path.  With a pool the frame path is faster, as its lines can be
+			// run in parallel.
+			if ((dim <= 2) && !f_showk && !pool) {
+				ProcessLines(buffer);
+				return;
+			}
 
-			memcpy(Frame[0].rawbuffer, buffer, (in_x * in_y * 2));
+			frame_t *oldest = Frame[nframes - 1];
+
+			for (int i = nframes - 1; i > 0; i--) {
+				Frame[i] = Frame[i - 1];
+			}
+			Frame[0] = oldest;
+
+			// rawbuffer is overwritten below and SplitIQ() clears cbuf, but the
+			// comb stages only write part of each plane 
+			memset(Frame[0]->clpbuffer, 0, sizeof(Frame[0]->clpbuffer));
+			memset(Frame[0]->combk, 0, sizeof(Frame[0]->combk));
+
+			memcpy(Frame[0]->rawbuffer, buffer, (in_x * in_y * 2));
 
 			Split1D(0);
 			if (dim >= 2) Split2D(0); 
@@ -850,7 +1194,7 @@ class Comb
 		
 			if (dim >= 3) {
 				if (f_opticalflow && (framecount >= 1)) {
-					memcpy(tbuf, Frame[0].cbuf, sizeof(tbuf));	
+					memcpy(tbuf, Frame[0]->cbuf, sizeof(tbuf));	
 					AdjustY(0, tbuf);
 					DoYNR(0, tbuf, 4);
 					DoCNR(0, tbuf, 4);
@@ -867,14 +1211,14 @@ class Comb
 
 			SplitIQ(f);
 
-			memcpy(tbuf, Frame[f].cbuf, sizeof(tbuf));	
+			memcpy(tbuf, Frame[f]->cbuf, sizeof(tbuf));	
 
 			AdjustY(f, tbuf);
 			if (f_colorlpf) FilterIQ(tbuf, f);
 
 			// copy VBI	
 			for (int l = 20; l < 44; l++) {
-				uint16_t *line = &Frame[f].rawbuffer[l * in_x];	
+				uint16_t *line = &Frame[f]->rawbuffer[l * in_x];	
 					
 				for (int h = 4; h < 840; h++) {
 					tbuf[l - 20].p[h].y = line[h]; 
@@ -885,15 +1229,14 @@ class Comb
 			DoCNR(f, tbuf);
 			ToRGB(f, firstline, tbuf);
 	
-			PostProcess(f);
+			PostProcess(Frame[f]->rawbuffer);
 			framecount++;
 
 			return;
 		}
 		
-		int PostProcess(int fnum) {
+		int PostProcess(uint16_t *fbuf) {
 			int fstart = -1;
-			uint16_t *fbuf = Frame[fnum].rawbuffer;
 
 			int rout_x = f_wide ? out_x : 744;
 			int roffset = f_wide ? 0 : 78;
@@ -940,6 +1283,112 @@ class Comb
 	
 Comb comb;
 
+// Reads one frame, returns false at the end of the input
+bool ReadFrame(int fd, uint16_t *buf)
+{
+	unsigned char *cbuf = (unsigned char *)buf;
+	int bufsize = in_x * in_y * 2;
+	int rv = 0;
+
+	while (rv < bufsize) {
+		int rv2 = read(fd, &cbuf[rv], bufsize - rv);
+		if (rv2 <= 0) return false;
+		rv += rv2;
+	}
+
+	return true;
+}
+
+// -j: reading, combing, NR/RGB and writing each get their own thread(s).
+//
+// For 1D/2D every frame is combed independently, so nthreads workers comb
+// frames in parallel and this thread puts them back in order for NR/RGB
+// (whose filters run across frame boundaries).  3D keeps its frame history
+// and filter state in one sequence, so there the I/O is overlapped and the
+// lines of each frame are spread over the threads instead.
+void ProcessThreaded(int fd, int nthreads)
+{
+	int njobs = nthreads + 4;
+	bool parallel = (dim <= 2) && !f_showk;
+
+	if (!parallel) comb.SetThreads(nthreads);
+
+	WorkQueue<comb_job_t *> freeq(njobs), inq(njobs), doneq(njobs);
+	vector<std::thread> workers;
+	std::atomic<int> running(nthreads);
+	comb_job_t *job;
+
+	for (int i = 0; i < njobs; i++) {
+		freeq.push(new comb_job_t);
+	}
+
+	comb.StartWriter();
+
+	std::thread reader([&] {
+		comb_job_t *rjob;
+		long long seq = 0;
+
+		while (freeq.pop(rjob)) {
+			if (!ReadFrame(fd, rjob->rawbuffer)) {
+				freeq.push(rjob);
+				break;
+			}
+
+			rjob->seq = seq++;
+			inq.push(rjob);
+		}
+
+		inq.close();
+	});
+
+	if (parallel) {
+		for (int i = 0; i < nthreads; i++) {
+			workers.push_back(std::thread([&] {
+				comb_job_t *wjob;
+
+				while (inq.pop(wjob)) {
+					comb.CombJob(wjob);
+					doneq.push(wjob);
+				}
+
+				if (--running == 0) doneq.close();
+			}));
+		}
+
+		std::map<long long, comb_job_t *> pending;
+		long long next = 0;
+
+		while (doneq.pop(job)) {
+			pending[job->seq] = job;
+
+			while (pending.count(next)) {
+				job = pending[next];
+				pending.erase(next++);
+
+				comb.FinishJob(job);
+				freeq.push(job);
+			}
+		}
+	} else {
+		while (inq.pop(job)) {
+			comb.Process(job->rawbuffer, dim);
+			freeq.push(job);
+		}
+	}
+
+	reader.join();
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+
+	comb.StopWriter();
+
+	freeq.close();
+	while (freeq.pop(job)) {
+		delete job;
+	}
+}
+
 void usage()
 {
 	cerr << "comb: " << endl;
@@ -950,6 +1399,7 @@ void usage()
 	cerr << "-f : use separate file for each frame\n";
 	cerr << "-p : use white flag/frame # for pulldown\n";	
 	cerr << "-l [line] : debug selected line - extra prints for that line, and blacks it out\n";	
+	cerr << "-j [threads] : run reading/combing/writing on separate threads, combing 1D/2D on [threads] threads\n";	
 	cerr << "-h : this\n";	
 }
 
@@ -960,6 +1410,7 @@ int main(int argc, char *argv[])
 	unsigned short inbuf[in_x * 525 * 2];
 	unsigned char *cinbuf = (unsigned char *)inbuf;
 	int c;
+	int nthreads = 1;
 
 	char out_filename[256] = "";
 
@@ -969,7 +1420,7 @@ int main(int argc, char *argv[])
 
 	opterr = 0;
 	
-	while ((c = getopt(argc, argv, "WQLakN:tFc:r:R:m8OwvDd:Bb:I:w:i:o:fphn:l:")) != -1) {
+	while ((c = getopt(argc, argv, "WQLakN:tFc:r:R:m8OwvDd:Bb:I:w:i:o:fphn:l:j:")) != -1) {
 		switch (c) {
 			case 'W':
 				f_wide = !f_wide;
@@ -1062,6 +1513,9 @@ int main(int argc, char *argv[])
 			case 'k':
 				f_showk = true;
 				break;
+			case 'j':
+				sscanf(optarg, "%d", &nthreads);
+				break;
 			default:
 				return -1;
 		} 
@@ -1083,7 +1537,7 @@ int main(int argc, char *argv[])
 	}
 
 	p_2dcore = 0 * irescale;
-	p_2drange = 10 * irescale;
+	p_2drange = 45 * irescale;
 
 	black_u16 = ire_to_u16(black_ire);
 
@@ -1096,6 +1550,18 @@ int main(int argc, char *argv[])
 
 	cout << std::setprecision(8);
 
+	if (nthreads > 1) {
+		// The monitor window has to be drawn from this thread, and with
+		// -m/-O what matters is how soon each frame comes out, so those
+		// only split up the lines within a frame
+		if (f_monitor || f_oneframe) {
+			comb.SetThreads(nthreads);
+		} else {
+			ProcessThreaded(fd, nthreads);
+			return 0;
+		}
+	}
+
 	int bufsize = in_x * in_y * 2;
 
 	rv = read(fd, inbuf, bufsize);
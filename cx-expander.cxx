@@ -15,8 +15,8 @@ double clamp(double v, double low, double high)
         else return v;
 }
 
-Filter f_left(f_a500_48k), f_left30(f_a40h_48k);
-Filter f_right(f_a500_48k), f_right30(f_a40h_48k);
+sf_a500_48k_t f_left(cs_a500_48k_b, cs_a500_48k_a), f_right(cs_a500_48k_b, cs_a500_48k_a);
+sf_a40h_48k_t f_left30(cs_a40h_48k_b, cs_a40h_48k_a), f_right30(cs_a40h_48k_b, cs_a40h_48k_a);
 
 int snum = 0;
 double slow = 0, fast = 0;
@@ -31,21 +31,28 @@ double m14db = 0.199526231496888;
  *  - Per PR-8210 service manual, at 75% modulation should be 87.3% higher (914mVrms vs 488mVrms)
  */
 
+// 1024 samples, 2 channels, 2 bytes/sample
+const int blen = 1024;
+
 void Process(uint16_t *buf, int nsamp)
 {
-	for (int i = 0; i < nsamp; i++) {
-		double left = (buf[i * 2] - 32768); 
-		double right = (buf[(i * 2 + 1)] - 32768); 
+	double orig_left[blen] = {}, orig_right[blen] = {};
+	double left[blen], right[blen];
+	uint16_t obuf[blen * 2];
 
-		snum++;
+	// deinterleave and run the 500hz filters over the whole block first
+	for (int i = 0; i < nsamp; i++) {
+		orig_left[i] = (buf[i * 2] - 32768); 
+		orig_right[i] = (buf[(i * 2 + 1)] - 32768); 
+	}
 
-		double orig_left = left;
-		double orig_right = right;
+	f_left.feed(orig_left, left, nsamp);
+	f_right.feed(orig_right, right, nsamp);
 
-		left = (f_left.feed(left));
-		right = (f_right.feed(right));
+	for (int i = 0; i < nsamp; i++) {
+		snum++;
 
-		double _max = max(fabs(left), fabs(right));
+		double _max = max(fabs(left[i]), fabs(right[i]));
 
 //		if ((snum < 100) || (snum > 2000)) _max = 0; 
 //		if ((snum < 100)) _max = 0; 
@@ -54,7 +61,7 @@ void Process(uint16_t *buf, int nsamp)
 		fast = (fast * .9998);
 		if (_max > fast) fast = min(_max, fast + (_max * .040));	
 	
-//		cerr << snum << " IN " << left << ' ' << right << ' ' ;
+//		cerr << snum << " IN " << left[i] << ' ' << right[i] << ' ' ;
 
 		slow = (slow * .999985);
 		if (_max > slow) slow = min(_max, slow + (_max * .0020));	
@@ -68,31 +75,27 @@ void Process(uint16_t *buf, int nsamp)
 
 		// 7200-1500=5500 is the (current) 0db point for val
 
-		left = orig_left * m14db;
-		right = orig_right * m14db;
+		left[i] = orig_left[i] * m14db;
+		right[i] = orig_right[i] * m14db;
 
-		left *= 1 + (val / (factor * m14db));
-		right *= 1 + (val / (factor * m14db));
-
-		left = f_left30.feed(left);
-		right = f_right30.feed(right);
+		left[i] *= 1 + (val / (factor * m14db));
+		right[i] *= 1 + (val / (factor * m14db));
+	}
 
-//		cerr << ' ' << _max << " F:" << fast << " S:" << slow << ' ' << val << " OUT " << left << ' ' << right << ' ' << left / orig_left << ' ' << right / orig_right << endl;
+	f_left30.feed(left, left, nsamp);
+	f_right30.feed(right, right, nsamp);
 
+	for (int i = 0; i < nsamp; i++) {
 		// need to reduce it to prevent clipping 
-		left *= .4;
-		right *= .4;
+		left[i] *= .4;
+		right[i] *= .4;
 	
-		uint16_t obuf[2];
-
-		obuf[0] = clamp(left + 32768, 0, 65535);
-		obuf[1] = clamp(right + 32768, 0, 65535);
-		write(1, obuf, 4);
+		obuf[i * 2] = clamp(left[i] + 32768, 0, 65535);
+		obuf[i * 2 + 1] = clamp(right[i] + 32768, 0, 65535);
 	}
-}
 
-// 1024 samples, 2 channels, 2 bytes/sample
-const int blen = 1024;
+	write(1, obuf, nsamp * 4);
+}
 
 uint16_t inbuf[blen * 2];
 unsigned char *cinbuf = (unsigned char *)inbuf;
@@ -5,7 +5,9 @@
 #ifndef DEEMP_H
 #define DEEMP_H
 
-std::vector<double> c_boost_b = {
+#include "static-filter.h"
+
+constexpr double cs_boost_b[33] = {
 	4.387575368399080e-04, 1.632895622862065e-03, 2.537748875966843e-03, 2.044228963833118e-03, 
 	-1.184428038595139e-03, -6.824725464908460e-03, -1.141112158933924e-02, -9.361696552715498e-03, 
 	2.990718843871222e-03, 2.256903353665731e-02, 3.778448293341898e-02, 3.256028527533292e-02, 
@@ -16,13 +18,16 @@ std::vector<double> c_boost_b = {
 	-1.184428038595139e-03, 2.044228963833118e-03, 2.537748875966845e-03, 1.632895622862065e-03, 
 	4.387575368399080e-04
 };
-std::vector<double> c_boost_a = {
+constexpr double cs_boost_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_boost_b(cs_boost_b, cs_boost_b + 33);
+std::vector<double> c_boost_a(cs_boost_a, cs_boost_a + 1);
 
 Filter f_boost(c_boost_b, c_boost_a);
+typedef StaticFilter<33, false> sf_boost_t;
 
-std::vector<double> c_boost10_b = {
+constexpr double cs_boost10_b[33] = {
 	6.263255080839859e-04, -3.915507880949289e-04, -1.916735209842008e-03, -3.819172995004064e-03, 
 	-5.042485617935916e-03, -3.758388089387953e-03, 1.610695988129704e-03, 1.088981776984434e-02, 
 	2.102516852905990e-02, 2.621377901216247e-02, 1.965771061382473e-02, -3.529284119720894e-03, 
@@ -33,13 +38,16 @@ std::vector<double> c_boost10_b = {
 	-5.042485617935916e-03, -3.819172995004064e-03, -1.916735209842010e-03, -3.915507880949289e-04, 
 	6.263255080839859e-04
 };
-std::vector<double> c_boost10_a = {
+constexpr double cs_boost10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_boost10_b(cs_boost10_b, cs_boost10_b + 33);
+std::vector<double> c_boost10_a(cs_boost10_a, cs_boost10_a + 1);
 
 Filter f_boost10(c_boost10_b, c_boost10_a);
+typedef StaticFilter<33, false> sf_boost10_t;
 
-std::vector<double> c_color_b = {
+constexpr double cs_color_b[33] = {
 	4.296424055924476e-03, 4.820368376227816e-03, 6.300710847429374e-03, 8.706323730295659e-03, 
 	1.196573459156954e-02, 1.596958998357160e-02, 2.057483967978480e-02, 2.561047195098441e-02, 
 	3.088455666359826e-02, 3.619229008456978e-02, 4.132468628021605e-02, 4.607752734167055e-02, 
@@ -50,13 +58,16 @@ std::vector<double> c_color_b = {
 	1.196573459156954e-02, 8.706323730295659e-03, 6.300710847429381e-03, 4.820368376227816e-03, 
 	4.296424055924476e-03
 };
-std::vector<double> c_color_a = {
+constexpr double cs_color_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_color_b(cs_color_b, cs_color_b + 33);
+std::vector<double> c_color_a(cs_color_a, cs_color_a + 1);
 
 Filter f_color(c_color_b, c_color_a);
+typedef StaticFilter<33, false> sf_color_t;
 
-std::vector<double> c_lpf_b = {
+constexpr double cs_lpf_b[31] = {
 	-1.676812318972605e-03, -5.374936889747957e-04, 2.254940908923398e-03, 4.022274254815429e-03, 
 	-1.073502430983471e-04, -9.045704503701426e-03, -1.052619532644138e-02, 5.739018325719545e-03, 
 	2.654003770829400e-02, 1.932369268654869e-02, -2.683398362195290e-02, -6.680566651536424e-02, 
@@ -66,13 +77,16 @@ std::vector<double> c_lpf_b = {
 	-1.052619532644138e-02, -9.045704503701438e-03, -1.073502430983472e-04, 4.022274254815429e-03, 
 	2.254940908923399e-03, -5.374936889747957e-04, -1.676812318972605e-03
 };
-std::vector<double> c_lpf_a = {
+constexpr double cs_lpf_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lpf_b(cs_lpf_b, cs_lpf_b + 31);
+std::vector<double> c_lpf_a(cs_lpf_a, cs_lpf_a + 1);
 
 Filter f_lpf(c_lpf_b, c_lpf_a);
+typedef StaticFilter<31, false> sf_lpf_t;
 
-std::vector<double> c_lpf42_b = {
+constexpr double cs_lpf42_b[31] = {
 	1.613172645086048e-03, 6.727619992811485e-04, -1.621472972157981e-03, -4.439803146181067e-03, 
 	-4.386700689000996e-03, 2.049823178361324e-03, 1.272098110625865e-02, 1.733049859690708e-02, 
 	4.455855663190381e-03, -2.475177666520114e-02, -4.870918525511100e-02, -3.491898896829457e-02, 
@@ -82,13 +96,16 @@ std::vector<double> c_lpf42_b = {
 	1.272098110625865e-02, 2.049823178361327e-03, -4.386700689001000e-03, -4.439803146181067e-03, 
 	-1.621472972157981e-03, 6.727619992811485e-04, 1.613172645086048e-03
 };
-std::vector<double> c_lpf42_a = {
+constexpr double cs_lpf42_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lpf42_b(cs_lpf42_b, cs_lpf42_b + 31);
+std::vector<double> c_lpf42_a(cs_lpf42_a, cs_lpf42_a + 1);
 
 Filter f_lpf42(c_lpf42_b, c_lpf42_a);
+typedef StaticFilter<31, false> sf_lpf42_t;
 
-std::vector<double> c_lpf_comb_b = {
+constexpr double cs_lpf_comb_b[33] = {
 	6.577901011847756e-04, 1.160441860403559e-03, 2.089095713318518e-03, 3.693711458291047e-03, 
 	6.191480178152386e-03, 9.736650443288516e-03, 1.439523966910154e-02, 2.012773832743941e-02, 
 	2.678212842593536e-02, 3.409846319368048e-02, 4.172500964596507e-02, 4.924467913455562e-02, 
@@ -99,13 +116,16 @@ std::vector<double> c_lpf_comb_b = {
 	6.191480178152386e-03, 3.693711458291047e-03, 2.089095713318520e-03, 1.160441860403559e-03, 
 	6.577901011847756e-04
 };
-std::vector<double> c_lpf_comb_a = {
+constexpr double cs_lpf_comb_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lpf_comb_b(cs_lpf_comb_b, cs_lpf_comb_b + 33);
+std::vector<double> c_lpf_comb_a(cs_lpf_comb_a, cs_lpf_comb_a + 1);
 
 Filter f_lpf_comb(c_lpf_comb_b, c_lpf_comb_a);
+typedef StaticFilter<33, false> sf_lpf_comb_t;
 
-std::vector<double> c_lpf4_b = {
+constexpr double cs_lpf4_b[31] = {
 	-1.676812318972605e-03, -5.374936889747957e-04, 2.254940908923398e-03, 4.022274254815429e-03, 
 	-1.073502430983471e-04, -9.045704503701426e-03, -1.052619532644138e-02, 5.739018325719545e-03, 
 	2.654003770829400e-02, 1.932369268654869e-02, -2.683398362195290e-02, -6.680566651536424e-02, 
@@ -115,13 +135,16 @@ std::vector<double> c_lpf4_b = {
 	-1.052619532644138e-02, -9.045704503701438e-03, -1.073502430983472e-04, 4.022274254815429e-03, 
 	2.254940908923399e-03, -5.374936889747957e-04, -1.676812318972605e-03
 };
-std::vector<double> c_lpf4_a = {
+constexpr double cs_lpf4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lpf4_b(cs_lpf4_b, cs_lpf4_b + 31);
+std::vector<double> c_lpf4_a(cs_lpf4_a, cs_lpf4_a + 1);
 
 Filter f_lpf4(c_lpf4_b, c_lpf4_a);
+typedef StaticFilter<31, false> sf_lpf4_t;
 
-std::vector<double> c_lpf10_b = {
+constexpr double cs_lpf10_b[31] = {
 	1.530960711199011e-03, 4.310659751765302e-04, -1.889456548691174e-03, -4.446167541609470e-03, 
 	-3.877803004174978e-03, 2.888264273604397e-03, 1.315839165131086e-02, 1.665818472124762e-02, 
 	2.830990350722844e-03, -2.611421204951105e-02, -4.845515040504187e-02, -3.288557930240953e-02, 
@@ -131,13 +154,16 @@ std::vector<double> c_lpf10_b = {
 	1.315839165131086e-02, 2.888264273604400e-03, -3.877803004174981e-03, -4.446167541609470e-03, 
 	-1.889456548691175e-03, 4.310659751765302e-04, 1.530960711199011e-03
 };
-std::vector<double> c_lpf10_a = {
+constexpr double cs_lpf10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lpf10_b(cs_lpf10_b, cs_lpf10_b + 31);
+std::vector<double> c_lpf10_a(cs_lpf10_a, cs_lpf10_a + 1);
 
 Filter f_lpf10(c_lpf10_b, c_lpf10_a);
+typedef StaticFilter<31, false> sf_lpf10_t;
 
-std::vector<double> c_sync_b = {
+constexpr double cs_sync_b[25] = {
 	6.075969065158130e-03, 7.279892021844372e-03, 1.079480817355711e-02, 1.639167595194184e-02, 
 	2.369650623004010e-02, 3.221586593521699e-02, 4.137077454308703e-02, 5.053664384139356e-02, 
 	5.908648107002102e-02, 6.643434042255983e-02, 7.207598498652683e-02, 7.562391249497802e-02, 
@@ -146,78 +172,96 @@ std::vector<double> c_sync_b = {
 	2.369650623004012e-02, 1.639167595194184e-02, 1.079480817355711e-02, 7.279892021844377e-03, 
 	6.075969065158130e-03
 };
-std::vector<double> c_sync_a = {
+constexpr double cs_sync_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_sync_b(cs_sync_b, cs_sync_b + 25);
+std::vector<double> c_sync_a(cs_sync_a, cs_sync_a + 1);
 
 Filter f_sync(c_sync_b, c_sync_a);
+typedef StaticFilter<25, false> sf_sync_t;
 
-std::vector<double> c_ntscsyncbpf4_b = {
+constexpr double cs_ntscsyncbpf4_b[17] = {
 	-2.194588824998181e-03, -2.241885181851027e-03, -3.556938285547979e-08, 7.149468083983168e-03, 
 	1.504464947108959e-02, 1.413792770224243e-02, 4.827070127607497e-08, -1.910232916198251e-02, 
 	9.744134904203963e-01, -1.910232916198251e-02, 4.827070127607497e-08, 1.413792770224243e-02, 
 	1.504464947108959e-02, 7.149468083983166e-03, -3.556938285547979e-08, -2.241885181851029e-03, 
 	-2.194588824998181e-03
 };
-std::vector<double> c_ntscsyncbpf4_a = {
+constexpr double cs_ntscsyncbpf4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_ntscsyncbpf4_b(cs_ntscsyncbpf4_b, cs_ntscsyncbpf4_b + 17);
+std::vector<double> c_ntscsyncbpf4_a(cs_ntscsyncbpf4_a, cs_ntscsyncbpf4_a + 1);
 
 Filter f_ntscsyncbpf4(c_ntscsyncbpf4_b, c_ntscsyncbpf4_a);
+typedef StaticFilter<17, false> sf_ntscsyncbpf4_t;
 
-std::vector<double> c_esync8_b = {
+constexpr double cs_esync8_b[17] = {
 	-1.288201184857410e-03, 4.093423113188409e-04, 6.224527039199806e-03, 2.110849830652016e-02, 
 	4.739617605088404e-02, 8.250075794592006e-02, 1.188577010335986e-01, 1.464290909649238e-01, 
 	1.567242150649841e-01, 1.464290909649238e-01, 1.188577010335986e-01, 8.250075794592009e-02, 
 	4.739617605088404e-02, 2.110849830652015e-02, 6.224527039199806e-03, 4.093423113188412e-04, 
 	-1.288201184857410e-03
 };
-std::vector<double> c_esync8_a = {
+constexpr double cs_esync8_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_esync8_b(cs_esync8_b, cs_esync8_b + 17);
+std::vector<double> c_esync8_a(cs_esync8_a, cs_esync8_a + 1);
 
 Filter f_esync8(c_esync8_b, c_esync8_a);
+typedef StaticFilter<17, false> sf_esync8_t;
 
-std::vector<double> c_esync4_b = {
+constexpr double cs_esync4_b[17] = {
 	-1.288201184857410e-03, 4.093423113188409e-04, 6.224527039199806e-03, 2.110849830652016e-02, 
 	4.739617605088404e-02, 8.250075794592006e-02, 1.188577010335986e-01, 1.464290909649238e-01, 
 	1.567242150649841e-01, 1.464290909649238e-01, 1.188577010335986e-01, 8.250075794592009e-02, 
 	4.739617605088404e-02, 2.110849830652015e-02, 6.224527039199806e-03, 4.093423113188412e-04, 
 	-1.288201184857410e-03
 };
-std::vector<double> c_esync4_a = {
+constexpr double cs_esync4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_esync4_b(cs_esync4_b, cs_esync4_b + 17);
+std::vector<double> c_esync4_a(cs_esync4_a, cs_esync4_a + 1);
 
 Filter f_esync4(c_esync4_b, c_esync4_a);
+typedef StaticFilter<17, false> sf_esync4_t;
 
-std::vector<double> c_esync10_b = {
+constexpr double cs_esync10_b[17] = {
 	1.314948153735855e-03, 4.176184084038104e-03, 1.237701116889665e-02, 2.877664743111265e-02, 
 	5.353852279529462e-02, 8.340992711770892e-02, 1.123646075634859e-01, 1.334532546868392e-01, 
 	1.411777939977763e-01, 1.334532546868392e-01, 1.123646075634859e-01, 8.340992711770896e-02, 
 	5.353852279529462e-02, 2.877664743111264e-02, 1.237701116889665e-02, 4.176184084038108e-03, 
 	1.314948153735855e-03
 };
-std::vector<double> c_esync10_a = {
+constexpr double cs_esync10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_esync10_b(cs_esync10_b, cs_esync10_b + 17);
+std::vector<double> c_esync10_a(cs_esync10_a, cs_esync10_a + 1);
 
 Filter f_esync10(c_esync10_b, c_esync10_a);
+typedef StaticFilter<17, false> sf_esync10_t;
 
-std::vector<double> c_esync32_b = {
+constexpr double cs_esync32_b[17] = {
 	6.251856365887978e-03, 1.007490458916189e-02, 2.067129060378126e-02, 3.783952993949011e-02, 
 	5.967985542286956e-02, 8.290115477059432e-02, 1.035070332890583e-01, 1.176969186742433e-01, 
 	1.227549126898265e-01, 1.176969186742433e-01, 1.035070332890583e-01, 8.290115477059434e-02, 
 	5.967985542286956e-02, 3.783952993949009e-02, 2.067129060378126e-02, 1.007490458916190e-02, 
 	6.251856365887978e-03
 };
-std::vector<double> c_esync32_a = {
+constexpr double cs_esync32_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_esync32_b(cs_esync32_b, cs_esync32_b + 17);
+std::vector<double> c_esync32_a(cs_esync32_a, cs_esync32_a + 1);
 
 Filter f_esync32(c_esync32_b, c_esync32_a);
+typedef StaticFilter<17, false> sf_esync32_t;
 
-std::vector<double> c_psync8_b = {
+constexpr double cs_psync8_b[33] = {
 	1.066668471191958e-03, 5.535133088366489e-04, -3.625255884794499e-04, -2.100536905877551e-03, 
 	-4.826528356082360e-03, -8.144924467056691e-03, -1.093933098527869e-02, -1.146541473780160e-02, 
 	-7.719669475065309e-03, 1.989775929431125e-03, 1.842709887066232e-02, 4.096211870315181e-02, 
@@ -228,13 +272,16 @@ std::vector<double> c_psync8_b = {
 	-4.826528356082360e-03, -2.100536905877551e-03, -3.625255884794503e-04, 5.535133088366489e-04, 
 	1.066668471191958e-03
 };
-std::vector<double> c_psync8_a = {
+constexpr double cs_psync8_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_psync8_b(cs_psync8_b, cs_psync8_b + 33);
+std::vector<double> c_psync8_a(cs_psync8_a, cs_psync8_a + 1);
 
 Filter f_psync8(c_psync8_b, c_psync8_a);
+typedef StaticFilter<33, false> sf_psync8_t;
 
-std::vector<double> c_psync4_b = {
+constexpr double cs_psync4_b[33] = {
 	1.066668471191958e-03, 5.535133088366489e-04, -3.625255884794499e-04, -2.100536905877551e-03, 
 	-4.826528356082360e-03, -8.144924467056691e-03, -1.093933098527869e-02, -1.146541473780160e-02, 
 	-7.719669475065309e-03, 1.989775929431125e-03, 1.842709887066232e-02, 4.096211870315181e-02, 
@@ -245,13 +292,16 @@ std::vector<double> c_psync4_b = {
 	-4.826528356082360e-03, -2.100536905877551e-03, -3.625255884794503e-04, 5.535133088366489e-04, 
 	1.066668471191958e-03
 };
-std::vector<double> c_psync4_a = {
+constexpr double cs_psync4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_psync4_b(cs_psync4_b, cs_psync4_b + 33);
+std::vector<double> c_psync4_a(cs_psync4_a, cs_psync4_a + 1);
 
 Filter f_psync4(c_psync4_b, c_psync4_a);
+typedef StaticFilter<33, false> sf_psync4_t;
 
-std::vector<double> c_psync10_b = {
+constexpr double cs_psync10_b[33] = {
 	-9.831262845988061e-04, -1.602938332776910e-03, -2.560383941941156e-03, -3.812673850918667e-03, 
 	-4.997128108381490e-03, -5.425112160463599e-03, -4.176757161302744e-03, -2.857242735306487e-04, 
 	7.022104195861240e-03, 1.809009290559837e-02, 3.265201738363843e-02, 4.976326851829847e-02, 
@@ -262,13 +312,16 @@ std::vector<double> c_psync10_b = {
 	-4.997128108381490e-03, -3.812673850918667e-03, -2.560383941941158e-03, -1.602938332776910e-03, 
 	-9.831262845988061e-04
 };
-std::vector<double> c_psync10_a = {
+constexpr double cs_psync10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_psync10_b(cs_psync10_b, cs_psync10_b + 33);
+std::vector<double> c_psync10_a(cs_psync10_a, cs_psync10_a + 1);
 
 Filter f_psync10(c_psync10_b, c_psync10_a);
+typedef StaticFilter<33, false> sf_psync10_t;
 
-std::vector<double> c_dsync_b = {
+constexpr double cs_dsync_b[33] = {
 	4.529500990800288e-03, 5.042565886563961e-03, 6.543687151896893e-03, 8.981720927353038e-03, 
 	1.226825957164825e-02, 1.628097813268541e-02, 2.086834898291219e-02, 2.585553998651212e-02, 
 	3.105126295536169e-02, 3.625529990284259e-02, 4.126640635953664e-02, 4.589027496220054e-02, 
@@ -279,13 +332,16 @@ std::vector<double> c_dsync_b = {
 	1.226825957164825e-02, 8.981720927353038e-03, 6.543687151896899e-03, 5.042565886563961e-03, 
 	4.529500990800288e-03
 };
-std::vector<double> c_dsync_a = {
+constexpr double cs_dsync_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_dsync_b(cs_dsync_b, cs_dsync_b + 33);
+std::vector<double> c_dsync_a(cs_dsync_a, cs_dsync_a + 1);
 
 Filter f_dsync(c_dsync_b, c_dsync_a);
+typedef StaticFilter<33, false> sf_dsync_t;
 
-std::vector<double> c_dsync4_b = {
+constexpr double cs_dsync4_b[21] = {
 	7.303869295435700e-03, 9.373681812569548e-03, 1.536907679358834e-02, 2.471693290630484e-02, 
 	3.651066972938141e-02, 4.959929457148313e-02, 6.270094081265259e-02, 7.452962766411167e-02, 
 	8.392262835864091e-02, 8.995575354480928e-02, 9.203504902204508e-02, 8.995575354480928e-02, 
@@ -293,13 +349,16 @@ std::vector<double> c_dsync4_b = {
 	3.651066972938141e-02, 2.471693290630484e-02, 1.536907679358834e-02, 9.373681812569548e-03, 
 	7.303869295435700e-03
 };
-std::vector<double> c_dsync4_a = {
+constexpr double cs_dsync4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_dsync4_b(cs_dsync4_b, cs_dsync4_b + 21);
+std::vector<double> c_dsync4_a(cs_dsync4_a, cs_dsync4_a + 1);
 
 Filter f_dsync4(c_dsync4_b, c_dsync4_a);
+typedef StaticFilter<21, false> sf_dsync4_t;
 
-std::vector<double> c_dsync10_b = {
+constexpr double cs_dsync10_b[33] = {
 	4.557803338423004e-03, 5.069474325791006e-03, 6.573035815238148e-03, 9.014902485437780e-03, 
 	1.230462007835800e-02, 1.631831041800226e-02, 2.090344220074397e-02, 2.588474191483322e-02, 
 	3.107101346089618e-02, 3.626259841086700e-02, 4.125918284918357e-02, 4.586764245028043e-02, 
@@ -310,13 +369,16 @@ std::vector<double> c_dsync10_b = {
 	1.230462007835800e-02, 9.014902485437780e-03, 6.573035815238154e-03, 5.069474325791006e-03, 
 	4.557803338423004e-03
 };
-std::vector<double> c_dsync10_a = {
+constexpr double cs_dsync10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_dsync10_b(cs_dsync10_b, cs_dsync10_b + 33);
+std::vector<double> c_dsync10_a(cs_dsync10_a, cs_dsync10_a + 1);
 
 Filter f_dsync10(c_dsync10_b, c_dsync10_a);
+typedef StaticFilter<33, false> sf_dsync10_t;
 
-std::vector<double> c_dsync32_b = {
+constexpr double cs_dsync32_b[33] = {
 	4.592475846300268e-03, 5.102418069356089e-03, 6.608945026058012e-03, 9.055477267697707e-03, 
 	1.234905612859623e-02, 1.636390694251490e-02, 2.094627623293840e-02, 2.592035623026675e-02, 
 	3.109506767872609e-02, 3.627143838875038e-02, 4.125029167881321e-02, 4.583994664914770e-02, 
@@ -327,13 +389,16 @@ std::vector<double> c_dsync32_b = {
 	1.234905612859623e-02, 9.055477267697707e-03, 6.608945026058018e-03, 5.102418069356089e-03, 
 	4.592475846300268e-03
 };
-std::vector<double> c_dsync32_a = {
+constexpr double cs_dsync32_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_dsync32_b(cs_dsync32_b, cs_dsync32_b + 33);
+std::vector<double> c_dsync32_a(cs_dsync32_a, cs_dsync32_a + 1);
 
 Filter f_dsync32(c_dsync32_b, c_dsync32_a);
+typedef StaticFilter<33, false> sf_dsync32_t;
 
-std::vector<double> c_sync4_b = {
+constexpr double cs_sync4_b[21] = {
 	7.303869295435700e-03, 9.373681812569548e-03, 1.536907679358834e-02, 2.471693290630484e-02, 
 	3.651066972938141e-02, 4.959929457148313e-02, 6.270094081265259e-02, 7.452962766411167e-02, 
 	8.392262835864091e-02, 8.995575354480928e-02, 9.203504902204508e-02, 8.995575354480928e-02, 
@@ -341,13 +406,16 @@ std::vector<double> c_sync4_b = {
 	3.651066972938141e-02, 2.471693290630484e-02, 1.536907679358834e-02, 9.373681812569548e-03, 
 	7.303869295435700e-03
 };
-std::vector<double> c_sync4_a = {
+constexpr double cs_sync4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_sync4_b(cs_sync4_b, cs_sync4_b + 21);
+std::vector<double> c_sync4_a(cs_sync4_a, cs_sync4_a + 1);
 
 Filter f_sync4(c_sync4_b, c_sync4_a);
+typedef StaticFilter<21, false> sf_sync4_t;
 
-std::vector<double> c_sync10_b = {
+constexpr double cs_sync10_b[33] = {
 	4.557803338423004e-03, 5.069474325791006e-03, 6.573035815238148e-03, 9.014902485437780e-03, 
 	1.230462007835800e-02, 1.631831041800226e-02, 2.090344220074397e-02, 2.588474191483322e-02, 
 	3.107101346089618e-02, 3.626259841086700e-02, 4.125918284918357e-02, 4.586764245028043e-02, 
@@ -358,13 +426,16 @@ std::vector<double> c_sync10_b = {
 	1.230462007835800e-02, 9.014902485437780e-03, 6.573035815238154e-03, 5.069474325791006e-03, 
 	4.557803338423004e-03
 };
-std::vector<double> c_sync10_a = {
+constexpr double cs_sync10_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_sync10_b(cs_sync10_b, cs_sync10_b + 33);
+std::vector<double> c_sync10_a(cs_sync10_a, cs_sync10_a + 1);
 
 Filter f_sync10(c_sync10_b, c_sync10_a);
+typedef StaticFilter<33, false> sf_sync10_t;
 
-std::vector<double> c_nr_b = {
+constexpr double cs_nr_b[25] = {
 	1.141291975113614e-04, -1.857019211291029e-03, -4.499636864042073e-03, -5.577680979937061e-03, 
 	-4.423694440267179e-04, 1.309163063177155e-02, 2.861211356202848e-02, 3.029931283148555e-02, 
 	1.098965697652802e-03, -6.398130386469833e-02, -1.492080690537196e-01, -2.223459379380252e-01, 
@@ -373,13 +444,16 @@ std::vector<double> c_nr_b = {
 	-4.423694440267185e-04, -5.577680979937061e-03, -4.499636864042074e-03, -1.857019211291030e-03, 
 	1.141291975113614e-04
 };
-std::vector<double> c_nr_a = {
+constexpr double cs_nr_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_nr_b(cs_nr_b, cs_nr_b + 25);
+std::vector<double> c_nr_a(cs_nr_a, cs_nr_a + 1);
 
 Filter f_nr(c_nr_b, c_nr_a);
+typedef StaticFilter<25, false> sf_nr_t;
 
-std::vector<double> c_nr28_b = {
+constexpr double cs_nr28_b[25] = {
 	-3.807292198398358e-03, 1.043166382630296e-02, 1.813581376606307e-02, -4.262438154896549e-03, 
 	-4.520476805475866e-02, -3.563839187235995e-02, 4.751035796026731e-02, 9.840625099698347e-02, 
 	1.366646446375817e-02, -1.197142079346093e-01, -1.095831494662556e-01, 5.494565292866414e-02, 
@@ -388,13 +462,16 @@ std::vector<double> c_nr28_b = {
 	-4.520476805475872e-02, -4.262438154896549e-03, 1.813581376606309e-02, 1.043166382630296e-02, 
 	-3.807292198398358e-03
 };
-std::vector<double> c_nr28_a = {
+constexpr double cs_nr28_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_nr28_b(cs_nr28_b, cs_nr28_b + 25);
+std::vector<double> c_nr28_a(cs_nr28_a, cs_nr28_a + 1);
 
 Filter f_nr28(c_nr28_b, c_nr28_a);
+typedef StaticFilter<25, false> sf_nr28_t;
 
-std::vector<double> c_lp18_b = {
+constexpr double cs_lp18_b[25] = {
 	-1.140610593840190e-04, 1.855910522066364e-03, 4.496950462697482e-03, 5.574350957951538e-03, 
 	4.421053378543315e-04, -1.308381458456714e-02, -2.859503137902866e-02, -3.028122334622485e-02, 
 	-1.098309586278286e-03, 6.394310534647929e-02, 1.491189879190769e-01, 2.222131915754436e-01, 
@@ -403,83 +480,104 @@ std::vector<double> c_lp18_b = {
 	4.421053378543321e-04, 5.574350957951538e-03, 4.496950462697484e-03, 1.855910522066365e-03, 
 	-1.140610593840190e-04
 };
-std::vector<double> c_lp18_a = {
+constexpr double cs_lp18_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_lp18_b(cs_lp18_b, cs_lp18_b + 25);
+std::vector<double> c_lp18_a(cs_lp18_a, cs_lp18_a + 1);
 
 Filter f_lp18(c_lp18_b, c_lp18_a);
+typedef StaticFilter<25, false> sf_lp18_t;
 
-std::vector<double> c_nrc_b = {
+constexpr double cs_nrc_b[17] = {
 	-3.148569668063267e-03, -4.941974513425438e-03, -9.929538598536455e-03, -1.787793973911701e-02, 
 	-2.783702315543740e-02, -3.829928032339736e-02, -4.750186865627083e-02, -5.380281552534787e-02, 
 	9.469899799540406e-01, -5.380281552534787e-02, -4.750186865627083e-02, -3.829928032339737e-02, 
 	-2.783702315543740e-02, -1.787793973911701e-02, -9.929538598536455e-03, -4.941974513425442e-03, 
 	-3.148569668063267e-03
 };
-std::vector<double> c_nrc_a = {
+constexpr double cs_nrc_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_nrc_b(cs_nrc_b, cs_nrc_b + 17);
+std::vector<double> c_nrc_a(cs_nrc_a, cs_nrc_a + 1);
 
 Filter f_nrc(c_nrc_b, c_nrc_a);
+typedef StaticFilter<17, false> sf_nrc_t;
 
-std::vector<double> c_colorlpi_b = {
+constexpr double cs_colorlpi_b[2] = {
 	2.267438981796600e-01, 2.267438981796600e-01
 };
-std::vector<double> c_colorlpi_a = {
+constexpr double cs_colorlpi_a[2] = {
 	1.000000000000000e+00, -5.465122036406802e-01
 };
+std::vector<double> c_colorlpi_b(cs_colorlpi_b, cs_colorlpi_b + 2);
+std::vector<double> c_colorlpi_a(cs_colorlpi_a, cs_colorlpi_a + 2);
 
 Filter f_colorlpi(c_colorlpi_b, c_colorlpi_a);
+typedef StaticFilter<2, true> sf_colorlpi_t;
 
-std::vector<double> c_colorlpq_b = {
+constexpr double cs_colorlpq_b[2] = {
 	1.169303716013410e-01, 1.169303716013410e-01
 };
-std::vector<double> c_colorlpq_a = {
+constexpr double cs_colorlpq_a[2] = {
 	1.000000000000000e+00, -7.661392567973181e-01
 };
+std::vector<double> c_colorlpq_b(cs_colorlpq_b, cs_colorlpq_b + 2);
+std::vector<double> c_colorlpq_a(cs_colorlpq_a, cs_colorlpq_a + 2);
 
 Filter f_colorlpq(c_colorlpq_b, c_colorlpq_a);
+typedef StaticFilter<2, true> sf_colorlpq_t;
 
 const int f_colorlpi_offset = 2;
 const int f_colorlpq_offset = 2;
-std::vector<double> c_colorbp4_b = {
+constexpr double cs_colorbp4_b[9] = {
 	3.524083455247119e-02, 5.701405570187425e-07, -2.408398699505458e-01, -7.721391739544892e-07, 
 	4.478385909901386e-01, -7.721391739544892e-07, -2.408398699505458e-01, 5.701405570187425e-07, 
 	3.524083455247119e-02
 };
-std::vector<double> c_colorbp4_a = {
+constexpr double cs_colorbp4_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_colorbp4_b(cs_colorbp4_b, cs_colorbp4_b + 9);
+std::vector<double> c_colorbp4_a(cs_colorbp4_a, cs_colorbp4_a + 1);
 
 Filter f_colorbp4(c_colorbp4_b, c_colorbp4_a);
+typedef StaticFilter<9, false> sf_colorbp4_t;
 
-std::vector<double> c_colorbp8_b = {
+constexpr double cs_colorbp8_b[17] = {
 	1.793619856237314e-02, 1.830493260618778e-02, 2.901791166132614e-07, -5.828484174075745e-02, 
 	-1.225780201867041e-01, -1.151386533377725e-01, -3.929884668654461e-07, 1.554887898923649e-01, 
 	2.279322267448763e-01, 1.554887898923649e-01, -3.929884668654461e-07, -1.151386533377726e-01, 
 	-1.225780201867041e-01, -5.828484174075742e-02, 2.901791166132614e-07, 1.830493260618780e-02, 
 	1.793619856237314e-02
 };
-std::vector<double> c_colorbp8_a = {
+constexpr double cs_colorbp8_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_colorbp8_b(cs_colorbp8_b, cs_colorbp8_b + 17);
+std::vector<double> c_colorbp8_a(cs_colorbp8_a, cs_colorbp8_a + 1);
 
 Filter f_colorbp8(c_colorbp8_b, c_colorbp8_a);
+typedef StaticFilter<17, false> sf_colorbp8_t;
 
-std::vector<double> c_audioin_b = {
+constexpr double cs_audioin_b[9] = {
 	6.264676297181575e-05, 5.011741037745260e-04, 1.754109363210841e-03, 3.508218726421682e-03, 
 	4.385273408027103e-03, 3.508218726421682e-03, 1.754109363210841e-03, 5.011741037745260e-04, 
 	6.264676297181575e-05
 };
-std::vector<double> c_audioin_a = {
+constexpr double cs_audioin_a[9] = {
 	1.000000000000000e+00, -4.296261223770345e+00, 8.605029163253322e+00, -1.030114121932771e+01, 
 	7.988654459506183e+00, -4.084698227805914e+00, 1.338972278884777e+00, -2.564275537013397e-01, 
 	2.190989428180733e-02
 };
+std::vector<double> c_audioin_b(cs_audioin_b, cs_audioin_b + 9);
+std::vector<double> c_audioin_a(cs_audioin_a, cs_audioin_a + 9);
 
 Filter f_audioin(c_audioin_b, c_audioin_a);
+typedef StaticFilter<9, true> sf_audioin_t;
 
-std::vector<double> c_leftbp_b = {
+constexpr double cs_leftbp_b[33] = {
 	4.350594178170080e-03, 3.343353081524374e-03, -1.073777500952160e-02, 6.809375467894310e-03, 
 	1.325000742922697e-02, -2.883374689763498e-02, 9.021888779772606e-03, 3.827116250507442e-02, 
 	-5.470668753938947e-02, 5.023399166322934e-04, 7.476449641552810e-02, -7.362913874573603e-02, 
@@ -490,13 +588,16 @@ std::vector<double> c_leftbp_b = {
 	1.325000742922697e-02, 6.809375467894310e-03, -1.073777500952161e-02, 3.343353081524374e-03, 
 	4.350594178170080e-03
 };
-std::vector<double> c_leftbp_a = {
+constexpr double cs_leftbp_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_leftbp_b(cs_leftbp_b, cs_leftbp_b + 33);
+std::vector<double> c_leftbp_a(cs_leftbp_a, cs_leftbp_a + 1);
 
 Filter f_leftbp(c_leftbp_b, c_leftbp_a);
+typedef StaticFilter<33, false> sf_leftbp_t;
 
-std::vector<double> c_rightbp_b = {
+constexpr double cs_rightbp_b[33] = {
 	-3.344787284659098e-04, 5.326122609378984e-03, -1.062063536469221e-02, 1.319272573678146e-02, 
 	-7.526868009955771e-03, -9.515227663022499e-03, 3.297088673017457e-02, -4.895470189529476e-02, 
 	4.174697639258265e-02, -5.524633741995795e-03, -4.753368515984026e-02, 9.023945938850933e-02, 
@@ -507,74 +608,92 @@ std::vector<double> c_rightbp_b = {
 	-7.526868009955771e-03, 1.319272573678146e-02, -1.062063536469222e-02, 5.326122609378984e-03, 
 	-3.344787284659098e-04
 };
-std::vector<double> c_rightbp_a = {
+constexpr double cs_rightbp_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_rightbp_b(cs_rightbp_b, cs_rightbp_b + 33);
+std::vector<double> c_rightbp_a(cs_rightbp_a, cs_rightbp_a + 1);
 
 Filter f_rightbp(c_rightbp_b, c_rightbp_a);
+typedef StaticFilter<33, false> sf_rightbp_t;
 
-std::vector<double> c_audiolp_b = {
+constexpr double cs_audiolp_b[9] = {
 	1.103668291221766e-11, 8.829346329774130e-11, 3.090271215420945e-10, 6.180542430841890e-10, 
 	7.725678038552363e-10, 6.180542430841890e-10, 3.090271215420945e-10, 8.829346329774130e-11, 
 	1.103668291221766e-11
 };
-std::vector<double> c_audiolp_a = {
+constexpr double cs_audiolp_a[9] = {
 	1.000000000000000e+00, -7.550146204334163e+00, 2.495159963175967e+01, -4.714203157763692e+01, 
 	5.569274730841198e+01, -4.212744248979740e+01, 1.992524061941851e+01, -5.387559298917377e+00, 
 	6.375920139210935e-01
 };
+std::vector<double> c_audiolp_b(cs_audiolp_b, cs_audiolp_b + 9);
+std::vector<double> c_audiolp_a(cs_audiolp_a, cs_audiolp_a + 9);
 
 Filter f_audiolp(c_audiolp_b, c_audiolp_a);
+typedef StaticFilter<9, true> sf_audiolp_t;
 
-std::vector<double> c_audiolp20_b = {
+constexpr double cs_audiolp20_b[9] = {
 	1.468003814358643e-06, 1.174403051486914e-05, 4.110410680204199e-05, 8.220821360408399e-05, 
 	1.027602670051050e-04, 8.220821360408399e-05, 4.110410680204199e-05, 1.174403051486914e-05, 
 	1.468003814358643e-06
 };
-std::vector<double> c_audiolp20_a = {
+constexpr double cs_audiolp20_a[9] = {
 	1.000000000000000e+00, -5.842265681731639e+00, 1.515746116298822e+01, -2.276500846449473e+01, 
 	2.161624934688777e+01, -1.327255888620213e+01, 5.141324339405003e+00, -1.147826229544440e+00, 
 	1.130002216684357e-01
 };
+std::vector<double> c_audiolp20_b(cs_audiolp20_b, cs_audiolp20_b + 9);
+std::vector<double> c_audiolp20_a(cs_audiolp20_a, cs_audiolp20_a + 9);
 
 Filter f_audiolp20(c_audiolp20_b, c_audiolp20_a);
+typedef StaticFilter<9, true> sf_audiolp20_t;
 
-std::vector<double> c_a500_48k_b = {
+constexpr double cs_a500_48k_b[5] = {
 	9.180235494788952e-01, -3.672094197915581e+00, 5.508141296873371e+00, -3.672094197915581e+00, 
 	9.180235494788952e-01
 };
-std::vector<double> c_a500_48k_a = {
+constexpr double cs_a500_48k_a[5] = {
 	1.000000000000000e+00, -3.828986095665020e+00, 5.501429593307183e+00, -3.515193865291172e+00, 
 	8.427672373989403e-01
 };
+std::vector<double> c_a500_48k_b(cs_a500_48k_b, cs_a500_48k_b + 5);
+std::vector<double> c_a500_48k_a(cs_a500_48k_a, cs_a500_48k_a + 5);
 
 Filter f_a500_48k(c_a500_48k_b, c_a500_48k_a);
+typedef StaticFilter<5, true> sf_a500_48k_t;
 
-std::vector<double> c_a500_44k_b = {
+constexpr double cs_a500_44k_b[17] = {
 	-1.720382225986335e-03, -2.505585658275189e-03, -4.730348153602204e-03, -8.093603282119600e-03, 
 	-1.210053119496442e-02, -1.614086472567362e-02, -1.958776236999286e-02, -2.190064570365665e-02, 
 	9.789966491496416e-01, -2.190064570365665e-02, -1.958776236999286e-02, -1.614086472567363e-02, 
 	-1.210053119496442e-02, -8.093603282119596e-03, -4.730348153602204e-03, -2.505585658275192e-03, 
 	-1.720382225986335e-03
 };
-std::vector<double> c_a500_44k_a = {
+constexpr double cs_a500_44k_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_a500_44k_b(cs_a500_44k_b, cs_a500_44k_b + 17);
+std::vector<double> c_a500_44k_a(cs_a500_44k_a, cs_a500_44k_a + 1);
 
 Filter f_a500_44k(c_a500_44k_b, c_a500_44k_a);
+typedef StaticFilter<17, false> sf_a500_44k_t;
 
-std::vector<double> c_a40h_48k_b = {
+constexpr double cs_a40h_48k_b[5] = {
 	9.931821905998739e-01, -3.972728762399496e+00, 5.959093143599244e+00, -3.972728762399496e+00, 
 	9.931821905998739e-01
 };
-std::vector<double> c_a40h_48k_a = {
+constexpr double cs_a40h_48k_a[5] = {
 	1.000000000000000e+00, -3.986317712211590e+00, 5.959046661447476e+00, -3.959139812214155e+00, 
 	9.864108637247646e-01
 };
+std::vector<double> c_a40h_48k_b(cs_a40h_48k_b, cs_a40h_48k_b + 5);
+std::vector<double> c_a40h_48k_a(cs_a40h_48k_a, cs_a40h_48k_a + 5);
 
 Filter f_a40h_48k(c_a40h_48k_b, c_a40h_48k_a);
+typedef StaticFilter<5, true> sf_a40h_48k_t;
 
-std::vector<double> c_hilbertr_b = {
+constexpr double cs_hilbertr_b[27] = {
 	-1.851851851851851e-02, -1.851851851851852e-02, -1.851851851851853e-02, -1.851851851851852e-02, 
 	-1.851851851851852e-02, -1.851851851851851e-02, -1.851851851851852e-02, -1.851851851851852e-02, 
 	-1.851851851851852e-02, -1.851851851851853e-02, -1.851851851851851e-02, -1.851851851851851e-02, 
@@ -583,13 +702,16 @@ std::vector<double> c_hilbertr_b = {
 	-1.851851851851852e-02, -1.851851851851851e-02, -1.851851851851852e-02, -1.851851851851851e-02, 
 	-1.851851851851851e-02, -1.851851851851852e-02, -1.851851851851852e-02
 };
-std::vector<double> c_hilbertr_a = {
+constexpr double cs_hilbertr_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_hilbertr_b(cs_hilbertr_b, cs_hilbertr_b + 27);
+std::vector<double> c_hilbertr_a(cs_hilbertr_a, cs_hilbertr_a + 1);
 
 Filter f_hilbertr(c_hilbertr_b, c_hilbertr_a);
+typedef StaticFilter<27, false> sf_hilbertr_t;
 
-std::vector<double> c_hilberti_b = {
+constexpr double cs_hilberti_b[27] = {
 	-1.962848289588822e-02, 1.553888205883852e-02, -2.487468723645288e-02, 1.217982123436020e-02, 
 	-3.207501495497921e-02, 9.300349555976757e-03, -4.293075142238723e-02, 6.740189523448187e-03, 
 	-6.185615955811680e-02, 4.388969514286946e-03, -1.050237374003279e-01, 2.164504384410227e-03, 
@@ -598,26 +720,32 @@ std::vector<double> c_hilberti_b = {
 	4.293075142238721e-02, -9.300349555976761e-03, 3.207501495497921e-02, -1.217982123436020e-02, 
 	2.487468723645289e-02, -1.553888205883851e-02, 1.962848289588822e-02
 };
-std::vector<double> c_hilberti_a = {
+constexpr double cs_hilberti_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_hilberti_b(cs_hilberti_b, cs_hilberti_b + 27);
+std::vector<double> c_hilberti_a(cs_hilberti_a, cs_hilberti_a + 1);
 
 Filter f_hilberti(c_hilberti_b, c_hilberti_a);
+typedef StaticFilter<27, false> sf_hilberti_t;
 
-std::vector<double> c_pilot_b = {
+constexpr double cs_pilot_b[17] = {
 	1.817901843543288e-02, 6.802041749100408e-17, -4.879895376103992e-02, 4.305004418889394e-16, 
 	1.227256007473350e-01, 1.693858423095544e-15, -1.966562944890921e-01, -4.565555273818813e-15, 
 	2.272802651342001e-01, -4.565555273818813e-15, -1.966562944890921e-01, 1.693858423095544e-15, 
 	1.227256007473350e-01, 4.305004418889392e-16, -4.879895376103992e-02, 6.802041749100414e-17, 
 	1.817901843543288e-02
 };
-std::vector<double> c_pilot_a = {
+constexpr double cs_pilot_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_pilot_b(cs_pilot_b, cs_pilot_b + 17);
+std::vector<double> c_pilot_a(cs_pilot_a, cs_pilot_a + 1);
 
 Filter f_pilot(c_pilot_b, c_pilot_a);
+typedef StaticFilter<17, false> sf_pilot_t;
 
-std::vector<double> c_fmdeemp_b = {
+constexpr double cs_fmdeemp_b[33] = {
 	4.795408695004658e-05, 7.097070232758715e-05, 1.162983920200813e-04, 2.377538100602408e-04, 
 	4.036970192157412e-04, 7.910534993095113e-04, 1.308086972794362e-03, 2.329168150063361e-03, 
 	3.867050819971179e-03, 6.323290047668000e-03, 1.047733988469225e-02, 1.648258718313018e-02, 
@@ -628,13 +756,16 @@ std::vector<double> c_fmdeemp_b = {
 	4.036970192157498e-04, 2.377538100602355e-04, 1.162983920200768e-04, 7.097070232758752e-05, 
 	4.795408695005016e-05
 };
-std::vector<double> c_fmdeemp_a = {
+constexpr double cs_fmdeemp_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_fmdeemp_b(cs_fmdeemp_b, cs_fmdeemp_b + 33);
+std::vector<double> c_fmdeemp_a(cs_fmdeemp_a, cs_fmdeemp_a + 1);
 
 Filter f_fmdeemp(c_fmdeemp_b, c_fmdeemp_a);
+typedef StaticFilter<33, false> sf_fmdeemp_t;
 
-std::vector<double> c_efm8_b = {
+constexpr double cs_efm8_b[49] = {
 	-9.111535510294286e-04, -1.251936114258105e-03, -1.732032006080746e-03, -2.385611144070486e-03, 
 	-3.204766378339000e-03, -4.127815310301767e-03, -5.033928296543917e-03, -5.745491521878144e-03, 
 	-6.038724679420682e-03, -5.662068221287681e-03, -4.360853906609531e-03, -1.905896801007799e-03, 
@@ -649,63 +780,81 @@ std::vector<double> c_efm8_b = {
 	-3.204766378339002e-03, -2.385611144070488e-03, -1.732032006080747e-03, -1.251936114258106e-03, 
 	-9.111535510294286e-04
 };
-std::vector<double> c_efm8_a = {
+constexpr double cs_efm8_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_efm8_b(cs_efm8_b, cs_efm8_b + 49);
+std::vector<double> c_efm8_a(cs_efm8_a, cs_efm8_a + 1);
 
 Filter f_efm8(c_efm8_b, c_efm8_a);
+typedef StaticFilter<49, false> sf_efm8_t;
 
-std::vector<double> c_syncid8_b = {
+constexpr double cs_syncid8_b[4] = {
 	3.081237304443338e-08, 9.243711913330015e-08, 9.243711913330015e-08, 3.081237304443338e-08
 };
-std::vector<double> c_syncid8_a = {
+constexpr double cs_syncid8_a[4] = {
 	1.000000000000000e+00, -2.987433650055722e+00, 2.974946132665443e+00, -9.875122361107359e-01
 };
+std::vector<double> c_syncid8_b(cs_syncid8_b, cs_syncid8_b + 4);
+std::vector<double> c_syncid8_a(cs_syncid8_a, cs_syncid8_a + 4);
 
 Filter f_syncid8(c_syncid8_b, c_syncid8_a);
+typedef StaticFilter<4, true> sf_syncid8_t;
 
-std::vector<double> c_syncid4_b = {
+constexpr double cs_syncid4_b[4] = {
 	2.449622763746039e-07, 7.348868291238116e-07, 7.348868291238116e-07, 2.449622763746039e-07
 };
-std::vector<double> c_syncid4_a = {
+constexpr double cs_syncid4_a[4] = {
 	1.000000000000000e+00, -2.974867424113648e+00, 2.950049679327468e+00, -9.751802955156089e-01
 };
+std::vector<double> c_syncid4_b(cs_syncid4_b, cs_syncid4_b + 4);
+std::vector<double> c_syncid4_a(cs_syncid4_a, cs_syncid4_a + 4);
 
 Filter f_syncid4(c_syncid4_b, c_syncid4_a);
+typedef StaticFilter<4, true> sf_syncid4_t;
 
-std::vector<double> c_syncid32_b = {
+constexpr double cs_syncid32_b[4] = {
 	2.247629572785221e-08, 6.742888718355662e-08, 6.742888718355662e-08, 2.247629572785221e-08
 };
-std::vector<double> c_syncid32_a = {
+constexpr double cs_syncid32_a[4] = {
 	1.000000000000000e+00, -2.988690281515673e+00, 2.977444427485293e+00, -9.887539661592547e-01
 };
+std::vector<double> c_syncid32_b(cs_syncid32_b, cs_syncid32_b + 4);
+std::vector<double> c_syncid32_a(cs_syncid32_a, cs_syncid32_a + 4);
 
 Filter f_syncid32(c_syncid32_b, c_syncid32_a);
+typedef StaticFilter<4, true> sf_syncid32_t;
 
-std::vector<double> c_syncid10_b = {
+constexpr double cs_syncid10_b[4] = {
 	1.579571604101607e-08, 4.738714812304821e-08, 4.738714812304821e-08, 1.579571604101607e-08
 };
-std::vector<double> c_syncid10_a = {
+constexpr double cs_syncid10_a[4] = {
 	1.000000000000000e+00, -2.989946914091736e+00, 2.979944296951953e+00, -9.899972564944884e-01
 };
+std::vector<double> c_syncid10_b(cs_syncid10_b, cs_syncid10_b + 4);
+std::vector<double> c_syncid10_a(cs_syncid10_a, cs_syncid10_a + 4);
 
 Filter f_syncid10(c_syncid10_b, c_syncid10_a);
+typedef StaticFilter<4, true> sf_syncid10_t;
 
 const int syncid4_offset = 165;
 const int syncid8_offset = 320;
 const int syncid32_offset = 360;
 const int syncid10_offset = 400;
-std::vector<double> c_linelen_b = {
+constexpr double cs_linelen_b[17] = {
 	2.539993835013457e-03, 5.744201059608384e-03, 1.470833651484297e-02, 3.145606087175080e-02, 
 	5.548225080960399e-02, 8.344191096544862e-02, 1.098889114382941e-01, 1.288595816690949e-01, 
 	1.357575056726855e-01, 1.288595816690949e-01, 1.098889114382941e-01, 8.344191096544865e-02, 
 	5.548225080960399e-02, 3.145606087175078e-02, 1.470833651484297e-02, 5.744201059608389e-03, 
 	2.539993835013457e-03
 };
-std::vector<double> c_linelen_a = {
+constexpr double cs_linelen_a[1] = {
 	1.000000000000000e+00
 };
+std::vector<double> c_linelen_b(cs_linelen_b, cs_linelen_b + 17);
+std::vector<double> c_linelen_a(cs_linelen_a, cs_linelen_a + 1);
 
 Filter f_linelen(c_linelen_b, c_linelen_a);
+typedef StaticFilter<17, false> sf_linelen_t;
 
 #endif
@@ -14,34 +14,37 @@ freq32 = 32
 
 # RJS: standardise output for C++
 
-def WriteFilter(name, b, a = [1.0]):
-	print("std::vector<double> c_",name,"_b = {",sep="",end="")
-	ct = len(b)
+def WriteArray(name, v):
+	ct = len(v)
+	print("constexpr double ",name,"[",ct,"] = {",sep="",end="")
 	for i in range(0, ct):
 		# insert a new line and an indent every 4 items
 		if i % 4 == 0:
 			print()
 			print("\t",end='')
 		# print the item
-		print("%.15e" % b[i], end='')
+		print("%.15e" % v[i], end='')
 		if i < ct-1:
 			print(", ", end='')
 	print("\n};")
 
-	print("std::vector<double> c_",name,"_a = {",sep="",end="")
-	ct = len(a)
-	for i in range(0, ct):
-		# insert a new line and an indent every 4 items
-		if i % 4 == 0:
-			print()
-			print("\t",end='')
-		# print the item
-		print("%.15e" % a[i], end="")
-		if i < ct-1:
-			print(", ", end='')
-	print("\n};")
+# Each filter is written as constexpr arrays (cs_*) for StaticFilter, the
+# std::vector copies (c_*) that Filter takes, a global Filter (f_*) and a
+# StaticFilter typedef (sf_*_t) with the tap count and type baked in
+def WriteFilter(name, b, a = [1.0]):
+	isIIR = len(a) > 1
+
+	# StaticFilter<NTaps, true> assumes the a and b arrays are the same size
+	if isIIR and len(a) != len(b):
+		raise ValueError("IIR filter " + name + " has len(a) != len(b)")
+
+	WriteArray("cs_" + name + "_b", b)
+	WriteArray("cs_" + name + "_a", a)
+	print("std::vector<double> c_",name,"_b(cs_",name,"_b, cs_",name,"_b + ",len(b),");",sep="")
+	print("std::vector<double> c_",name,"_a(cs_",name,"_a, cs_",name,"_a + ",len(a),");",sep="")
 	print()
 	print("Filter f_",name,"(c_",name,"_b, c_",name,"_a);",sep="")
+	print("typedef StaticFilter<",len(b),", ","true" if isIIR else "false","> sf_",name,"_t;",sep="")
 	print()
 
 
@@ -77,6 +80,8 @@ print()
 print ("#ifndef DEEMP_H")
 print ("#define DEEMP_H")
 print ();
+print ('#include "static-filter.h"')
+print ();
 
 Bboost = sps.firwin(33, 3.5 / (freq), window='hamming', pass_zero=False)
 WriteFilter("boost", Bboost)
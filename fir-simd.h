@@ -0,0 +1,186 @@
+#ifndef FIR_SIMD_H
+#define FIR_SIMD_H
+
+/*
+ * Kernels for symmetric (linear phase) FIR filters, shared by the Filter
+ * class in ld-decoder.h and the one in app/tbc.
+ *
+ * Nearly every FIR filtermaker.py produces has b[k] == b[n - 1 - k], so each
+ * pair of taps can be folded into one multiply:
+ *
+ *	y[i] = sum(k < n/2) h[k] * (x[i - k] + x[i - (n - 1 - k)])  (+ middle tap)
+ *
+ * The SIMD versions additionally compute several adjacent outputs at once.
+ *
+ * All kernels take an oldest-first buffer w of (nout + ntaps - 1) samples and
+ * write nout outputs, out[i] being the filter output for sample
+ * w[i + ntaps - 1].  hf holds the (ntaps + 1) / 2 folded taps.
+ *
+ * The implementation is picked once at runtime from the CPU features, so the
+ * same binary works on machines without AVX2.  Every kernel (and the scalar
+ * tail of the SIMD ones) accumulates each output in the same order and with
+ * the same kind of multiply-add, so an output doesn't depend on the CPU or on
+ * where it falls in the block.  Which kind is fixed when building: fused
+ * multiply-adds if the build targets FMA hardware (__FMA__, e.g. with
+ * -march=native on a recent x86), otherwise a separate multiply and add - the
+ * SIMD kernels are then built without FMA so the compiler can't fuse them.
+ */
+
+#include <stddef.h>
+#include <math.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FIR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+#ifdef __FMA__
+#define FIR_SYM_MADD(a, b, c)		fma(a, b, c)
+#define FIR_SYM_MADD256(a, b, c)	_mm256_fmadd_pd(a, b, c)
+#define FIR_SYM_MADD512(a, b, c)	_mm512_fmadd_pd(a, b, c)
+#define FIR_SYM_AVX2_TARGET		"avx2,fma"
+#else
+#define FIR_SYM_MADD(a, b, c)		(((a) * (b)) + (c))
+#define FIR_SYM_MADD256(a, b, c)	_mm256_add_pd(_mm256_mul_pd(a, b), c)
+#define FIR_SYM_MADD512(a, b, c)	_mm512_add_pd(_mm512_mul_pd(a, b), c)
+#define FIR_SYM_AVX2_TARGET		"avx2"
+#endif
+
+// AVX-512F brings FMA with it, and gcc fuses a multiply and add whenever the
+// target has FMA, so that has to be turned off explicitly for the kernels
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__FMA__)
+#define FIR_SYM_NO_CONTRACT		__attribute__((optimize("fp-contract=off")))
+#else
+#define FIR_SYM_NO_CONTRACT
+#endif
+
+typedef void (*fir_sym_fn)(const double *hf, int ntaps, const double *w, double *out, size_t nout);
+
+static inline void fir_sym_scalar(const double *hf, int ntaps, const double *w, double *out, size_t nout)
+{
+	int nhalf = ntaps / 2;
+
+	for (size_t i = 0; i < nout; i++) {
+		const double *p = &w[i + ntaps - 1];
+		double y0 = 0;
+
+		for (int k = 0; k < nhalf; k++) {
+			y0 = FIR_SYM_MADD(hf[k], p[-k] + p[-(ntaps - 1 - k)], y0);
+		}
+		if (ntaps & 1) y0 = FIR_SYM_MADD(hf[nhalf], p[-nhalf], y0);
+
+		out[i] = y0;
+	}
+}
+
+#ifdef FIR_SIMD_X86
+// 8 outputs per pass in two accumulators, to cover the FMA latency
+__attribute__((target(FIR_SYM_AVX2_TARGET))) FIR_SYM_NO_CONTRACT
+static inline void fir_sym_avx2(const double *hf, int ntaps, const double *w, double *out, size_t nout)
+{
+	int nhalf = ntaps / 2;
+	size_t i = 0;
+
+	for (; i + 8 <= nout; i += 8) {
+		const double *p = &w[i + ntaps - 1];
+		__m256d acc0 = _mm256_setzero_pd();
+		__m256d acc1 = _mm256_setzero_pd();
+
+		for (int k = 0; k < nhalf; k++) {
+			__m256d h = _mm256_set1_pd(hf[k]);
+			const double *n = p - k;
+			const double *o = p - (ntaps - 1 - k);
+
+			acc0 = FIR_SYM_MADD256(h, _mm256_add_pd(_mm256_loadu_pd(n), _mm256_loadu_pd(o)), acc0);
+			acc1 = FIR_SYM_MADD256(h, _mm256_add_pd(_mm256_loadu_pd(n + 4), _mm256_loadu_pd(o + 4)), acc1);
+		}
+		if (ntaps & 1) {
+			__m256d h = _mm256_set1_pd(hf[nhalf]);
+
+			acc0 = FIR_SYM_MADD256(h, _mm256_loadu_pd(p - nhalf), acc0);
+			acc1 = FIR_SYM_MADD256(h, _mm256_loadu_pd(p - nhalf + 4), acc1);
+		}
+
+		_mm256_storeu_pd(&out[i], acc0);
+		_mm256_storeu_pd(&out[i + 4], acc1);
+	}
+
+	fir_sym_scalar(hf, ntaps, &w[i], &out[i], nout - i);
+}
+
+__attribute__((target("avx512f"))) FIR_SYM_NO_CONTRACT
+static inline void fir_sym_avx512(const double *hf, int ntaps, const double *w, double *out, size_t nout)
+{
+	int nhalf = ntaps / 2;
+	size_t i = 0;
+
+	for (; i + 16 <= nout; i += 16) {
+		const double *p = &w[i + ntaps - 1];
+		__m512d acc0 = _mm512_setzero_pd();
+		__m512d acc1 = _mm512_setzero_pd();
+
+		for (int k = 0; k < nhalf; k++) {
+			__m512d h = _mm512_set1_pd(hf[k]);
+			const double *n = p - k;
+			const double *o = p - (ntaps - 1 - k);
+
+			acc0 = FIR_SYM_MADD512(h, _mm512_add_pd(_mm512_loadu_pd(n), _mm512_loadu_pd(o)), acc0);
+			acc1 = FIR_SYM_MADD512(h, _mm512_add_pd(_mm512_loadu_pd(n + 8), _mm512_loadu_pd(o + 8)), acc1);
+		}
+		if (ntaps & 1) {
+			__m512d h = _mm512_set1_pd(hf[nhalf]);
+
+			acc0 = FIR_SYM_MADD512(h, _mm512_loadu_pd(p - nhalf), acc0);
+			acc1 = FIR_SYM_MADD512(h, _mm512_loadu_pd(p - nhalf + 8), acc1);
+		}
+
+		_mm512_storeu_pd(&out[i], acc0);
+		_mm512_storeu_pd(&out[i + 8], acc1);
+	}
+
+	fir_sym_scalar(hf, ntaps, &w[i], &out[i], nout - i);
+}
+#endif
+
+static inline fir_sym_fn fir_sym_select()
+{
+#ifdef FIR_SIMD_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) return fir_sym_avx512;
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return fir_sym_avx2;
+#endif
+	return fir_sym_scalar;
+}
+
+static inline void fir_symmetric(const double *hf, int ntaps, const double *w, double *out, size_t nout)
+{
+	static const fir_sym_fn kernel = fir_sym_select();
+
+	kernel(hf, ntaps, w, out, nout);
+}
+
+// Returns true (and fills hf) if the taps are symmetric to within rounding
+// of the printed coefficients.  Short filters aren't worth the setup cost.
+static inline bool fir_sym_fold(const double *b, int ntaps, double *hf)
+{
+	double maxabs = 0;
+
+	if (ntaps < 8) return false;
+
+	for (int k = 0; k < ntaps; k++) {
+		if (fabs(b[k]) > maxabs) maxabs = fabs(b[k]);
+	}
+
+	for (int k = 0; k < ntaps / 2; k++) {
+		if (fabs(b[k] - b[ntaps - 1 - k]) > (maxabs * 1e-12)) return false;
+	}
+
+	for (int k = 0; k < ntaps / 2; k++) {
+		hf[k] = (b[k] + b[ntaps - 1 - k]) / 2;
+	}
+	if (ntaps & 1) hf[ntaps / 2] = b[ntaps / 2];
+
+	return true;
+}
+
+#endif
@@ -14,11 +14,22 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "fir-simd.h"
+
 // capture frequency and fundamental NTSC color frequency
 //const double CHZ = (1000000.0*(315.0/88.0)*8.0);
 
 using namespace std;
 
+// Sample type for the comb filter pipeline.  Building with -DLD_FLOAT runs it
+// in single precision, which halves the size of the frame buffers.  Filter
+// keeps its coefficients and history in double either way.
+#ifdef LD_FLOAT
+typedef float sample_t;
+#else
+typedef double sample_t;
+#endif
+
 //for macOS
 #ifndef M_PIl
 #define M_PIl M_PI
@@ -104,22 +115,129 @@ class Filter {
 		int order;
 		bool isIIR;
 		vector<double> a, b;
+		// b and a divided through by a[0] once here, instead of on every sample
+		vector<double> bn, an;
+
+		// History rings.  Each value is stored twice (at p and p + len) so the
+		// newest-first window x[xpos .. xpos + xlen - 1] is always contiguous and
+		// feeding a sample doesn't need to memmove the whole history.
 		vector<double> y, x;
+		int xlen, ylen;
+		int xpos, ypos;
+
+		// symmetric FIRs get the folded taps in hf and use the kernels in
+		// fir-simd.h for block feeds.  work holds history + input for them.
+		bool symmetric;
+		vector<double> hf, work;
+
+		void init() {
+			xlen = b.size();
+			ylen = a.size();
+
+			bn.resize(xlen);
+			an.resize(ylen);
+			for (int i = 0; i < xlen; i++) bn[i] = b[i] / a[0];
+			for (int i = 0; i < ylen; i++) an[i] = a[i] / a[0];
+
+			x.resize(xlen * 2);
+			y.resize(ylen * 2);
+
+			hf.resize((xlen + 1) / 2);
+			symmetric = (!isIIR || (ylen == 1)) && fir_sym_fold(bn.data(), xlen, hf.data());
+
+			clear();
+		}
+
+		// Block feed for symmetric FIRs.  The sums are folded and vectorised,
+		// so results match step() (and so feed(double)) to within rounding
+		// rather than exactly - feed a stream one way or the other if it has
+		// to be reproducible.  All of a symmetric FIR's block feeds go through
+		// here whatever their length, so block output doesn't depend on how
+		// the input is blocked.
+		void feed_symmetric(const double *in, double *out, size_t n) {
+			work.resize(n + xlen - 1);
+
+			// oldest-first: the last xlen - 1 inputs, then the new block
+			for (int k = 0; k < xlen - 1; k++) {
+				work[k] = x[xpos + xlen - 2 - k];
+			}
+			memcpy(&work[xlen - 1], in, sizeof(double) * n);
+
+			fir_symmetric(hf.data(), xlen, work.data(), out, n);
+
+			// leave the history as if each sample had gone through step()
+			xpos = 0;
+			for (int k = 0; k < xlen; k++) {
+				x[k] = x[k + xlen] = work[n + xlen - 2 - k];
+			}
+			y[ypos] = y[ypos + ylen] = out[n - 1];
+		}
+
+		// one step of the filter - the sum order matches the old memmove
+		// implementation exactly, so output is bit-identical
+		inline double step(double val) {
+			double y0 = 0;
+
+			xpos = xpos ? (xpos - 1) : (xlen - 1);
+			x[xpos] = x[xpos + xlen] = val;
+
+			const double *xp = &x[xpos];
+			const double *bp = bn.data();
+
+			if (isIIR) {
+				ypos = ypos ? (ypos - 1) : (ylen - 1);
+
+				const double *yp = &y[ypos];
+				const double *ap = an.data();
+
+				for (int o = 0; o < xlen; o++) {
+					y0 += bp[o] * xp[o];
+				}
+				for (int o = 1; o < ylen; o++) {
+					y0 -= ap[o] * yp[o];
+				}
+
+				y[ypos] = y[ypos + ylen] = y0;
+			} else {
+				if (order == 13) {
+					double t[4];
+		
+					// Cycling through destinations reduces pipeline stalls.	
+					t[0] = bp[0] * xp[0];
+					t[1] = bp[1] * xp[1];
+					t[2] = bp[2] * xp[2];
+					t[3] = bp[3] * xp[3];
+					t[0] += bp[4] * xp[4];
+					t[1] += bp[5] * xp[5];
+					t[2] += bp[6] * xp[6];
+					t[3] += bp[7] * xp[7];
+					t[0] += bp[8] * xp[8];
+					t[1] += bp[9] * xp[9];
+					t[2] += bp[10] * xp[10];
+					t[3] += bp[11] * xp[11];
+					y0 = t[0] + t[1] + t[2] + t[3] + (bp[12] * xp[12]);
+				} else for (int o = 0; o < order; o++) {
+					y0 += bp[o] * xp[o];
+				}
+
+				y[0] = y0;
+			}
+
+			return y0;
+		}
 	public:
 		Filter(int _order, const double *_a, const double *_b) {
 			order = _order + 1;
 			if (_a) {
-				a.insert(b.begin(), _a, _a + order);
+				a.insert(a.begin(), _a, _a + order);
 				isIIR = true;
 			} else {
 				a.push_back(1.0);
 				isIIR = false;
 			}
 			b.insert(b.begin(), _b, _b + order);
-			x.resize(order);
-			y.resize(order);
-	
-			clear();
+
+			init();
 		}
 		
 		Filter(vector<double> _b, vector<double> _a) {
@@ -127,16 +245,12 @@ class Filter {
 			a = _a;
 
 			order = b.size();
-			
-			x.resize(b.size() + 1);
-			y.resize(a.size() + 1);
+			isIIR = true;
 
 //			for (int i = 0; i < b.size(); i++) cerr << b[i] << endl;;
 //			for (int i = 0; i < b.size(); i++) cerr << a[i] << endl;;
 	
-			clear();
-
-			isIIR = true;
+			init();
 		}
 
 		Filter(Filter *orig) {
@@ -144,19 +258,18 @@ class Filter {
 			isIIR = orig->isIIR;
 			a = orig->a;
 			b = orig->b;
-			x.resize(b.size());
-			y.resize(a.size());
 				
-			clear();
+			init();
 		}
 
 		void clear(double val = 0) {
-			for (int i = 0; i < a.size(); i++) {
+			for (size_t i = 0; i < y.size(); i++) {
 				y[i] = val;
 			}
-			for (int i = 0; i < b.size(); i++) {
+			for (size_t i = 0; i < x.size(); i++) {
 				x[i] = val;
 			}
+			xpos = ypos = 0;
 		}
 
 		void dump() {
@@ -165,54 +278,25 @@ class Filter {
 		}
 
 		inline double feed(double val) {
-			double a0 = a[0];
-			double y0;
-
-			double *x_data = x.data();
-			double *y_data = y.data();
-
-			memmove(&x_data[1], x_data, sizeof(double) * (b.size() - 1)); 
-			if (isIIR) memmove(&y_data[1], y_data, sizeof(double) * (a.size() - 1)); 
+			return step(val);
+		}
 
-			x[0] = val;
-			y0 = 0; // ((b[0] / a0) * x[0]);
-			//cerr << "0 " << x[0] << ' ' << b[0] << ' ' << (b[0] * x[0]) << ' ' << y[0] << endl;
-			if (isIIR) {
-				for (int o = 0; o < b.size(); o++) {
-					y0 += ((b[o] / a0) * x[o]);
-				}
-				for (int o = 1; o < a.size(); o++) {
-					y0 -= ((a[o] / a0) * y[o]);
-				}
-//				for (int i = 0 ; i < b.size(); i++) cerr << 'b' << i << ' ' << b[i] << ' ' << x[i] << endl;
-//				for (int i = 0 ; i < a.size(); i++) cerr << 'a' << i << ' ' << a[i] << ' ' << y[i] << endl;
-			} else {
-				if (order == 13) {
-					double t[4];
-		
-					// Cycling through destinations reduces pipeline stalls.	
-					t[0] = b[0] * x[0];
-					t[1] = b[1] * x[1];
-					t[2] = b[2] * x[2];
-					t[3] = b[3] * x[3];
-					t[0] += b[4] * x[4];
-					t[1] += b[5] * x[5];
-					t[2] += b[6] * x[6];
-					t[3] += b[7] * x[7];
-					t[0] += b[8] * x[8];
-					t[1] += b[9] * x[9];
-					t[2] += b[10] * x[10];
-					t[3] += b[11] * x[11];
-					y0 = t[0] + t[1] + t[2] + t[3] + (b[12] * x[12]);
-				} else for (int o = 0; o < order; o++) {
-					y0 += b[o] * x[o];
-				}
+		// Block version of feed() - out[i] is what feed(in[i]) would have
+		// returned (exactly, except for symmetric FIRs, which only match to
+		// within rounding - see feed_symmetric).
+		// in and out may point at the same buffer.
+		inline void feed(const double *in, double *out, size_t n) {
+			if (symmetric && (n > 0)) {
+				feed_symmetric(in, out, n);
+				return;
 			}
 
-			y[0] = y0;
-			return y[0];
+			for (size_t i = 0; i < n; i++) {
+				out[i] = step(in[i]);
+			}
 		}
-		double val() {return y[0];}
+
+		double val() {return y[ypos];}
 };
 		
 // taken from http://www.paulinternet.nl/?page=bicubic
@@ -0,0 +1,61 @@
+#!/usr/bin/python3
+#
+# Compare two 16-bit RGB streams from comb-ntsc (e.g. the double and -DLD_FLOAT
+# builds on the same input) and report PSNR per frame and overall.
+#
+# usage: rgbpsnr.py [-w width] [-l lines] [-t min_db] reference.rgb test.rgb
+#
+# Exits with status 1 if any frame is below min_db, so it can be used as a
+# regression check (see 'make check-float').
+
+import sys
+import getopt
+import numpy as np
+
+def psnr(mse):
+	if mse == 0:
+		return float('inf')
+	return 10 * np.log10((65535.0 * 65535.0) / mse)
+
+def main(argv):
+	width = 744
+	lines = 480
+	min_db = 90.0
+
+	opts, args = getopt.getopt(argv, "w:l:t:")
+	for o, a in opts:
+		if o == '-w':
+			width = int(a)
+		elif o == '-l':
+			lines = int(a)
+		elif o == '-t':
+			min_db = float(a)
+
+	if len(args) != 2:
+		print("usage: rgbpsnr.py [-w width] [-l lines] [-t min_db] reference.rgb test.rgb")
+		return 2
+
+	ref = np.fromfile(args[0], dtype=np.uint16).astype(np.float64)
+	test = np.fromfile(args[1], dtype=np.uint16).astype(np.float64)
+
+	if len(ref) != len(test):
+		print("length mismatch: %d vs %d samples" % (len(ref), len(test)))
+		return 1
+
+	framelen = width * lines * 3
+	nframes = len(ref) // framelen
+
+	worst = float('inf')
+	for f in range(0, nframes):
+		err = ref[f * framelen:(f + 1) * framelen] - test[f * framelen:(f + 1) * framelen]
+		db = psnr(np.mean(err * err))
+		worst = min(worst, db)
+		print("frame %d: %.2f dB, max diff %d" % (f, db, np.max(np.abs(err))))
+
+	err = ref - test
+	print("overall: %.2f dB, worst frame %.2f dB" % (psnr(np.mean(err * err)), worst))
+
+	return 0 if worst >= min_db else 1
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,91 @@
+#ifndef STATIC_FILTER_H
+#define STATIC_FILTER_H
+
+/*
+ * Fixed-size counterpart of Filter, for use with the constexpr coefficient
+ * arrays (cs_<name>_b/_a) and sf_<name>_t typedefs that filtermaker.py writes
+ * into deemp.h.  With the tap count and FIR/IIR choice known at compile time
+ * the loops below fully unroll and the history stays in registers.
+ *
+ * The sums are done in the same order as Filter's exact path, so output is
+ * bit-identical to a Filter built from the same coefficients.  Filter is
+ * still the thing to use when the coefficients are only known at runtime.
+ */
+
+#include <stddef.h>
+
+template <int NTaps, bool IsIIR>
+class StaticFilter {
+	public:
+		// IIR filters from filtermaker.py always have len(a) == len(b)
+		static const int NA = IsIIR ? NTaps : 1;
+
+		StaticFilter(const double (&_b)[NTaps], const double (&_a)[NA]) {
+			for (int k = 0; k < NTaps; k++) b[k] = _b[k] / _a[0];
+			for (int k = 0; k < NA; k++) a[k] = _a[k] / _a[0];
+
+			clear();
+		}
+
+		void clear(double val = 0) {
+			for (int k = 0; k < NTaps; k++) x[k] = val;
+			for (int k = 0; k < NA; k++) y[k] = val;
+		}
+
+		inline double feed(double val) {
+			return step(b, a, x, y, val);
+		}
+
+		// out[i] is exactly what feed(in[i]) would have returned.  in and out
+		// may point at the same buffer.
+		inline void feed(const double *in, double *out, size_t n) {
+			// Local copies - out could alias the members as far as the
+			// compiler knows, which would force a reload every sample
+			double lb[NTaps], la[NA], lx[NTaps], ly[NA];
+
+			for (int k = 0; k < NTaps; k++) {
+				lb[k] = b[k];
+				lx[k] = x[k];
+			}
+			for (int k = 0; k < NA; k++) {
+				la[k] = a[k];
+				ly[k] = y[k];
+			}
+
+			for (size_t i = 0; i < n; i++) {
+				out[i] = step(lb, la, lx, ly, in[i]);
+			}
+
+			for (int k = 0; k < NTaps; k++) x[k] = lx[k];
+			for (int k = 0; k < NA; k++) y[k] = ly[k];
+		}
+
+		double val() {return y[0];}
+
+	protected:
+		double b[NTaps], a[NA];		// pre-divided by a[0]
+		double x[NTaps], y[NA];		// newest first
+
+		static inline double step(const double *b, const double *a, double *x, double *y, double val) {
+			double y0 = 0;
+
+			for (int k = NTaps - 1; k > 0; k--) x[k] = x[k - 1];
+			x[0] = val;
+
+			for (int k = 0; k < NTaps; k++) {
+				y0 += b[k] * x[k];
+			}
+
+			if (IsIIR) {
+				for (int k = NA - 1; k > 0; k--) y[k] = y[k - 1];
+				for (int k = 1; k < NA; k++) {
+					y0 -= a[k] * y[k];
+				}
+			}
+
+			y[0] = y0;
+			return y0;
+		}
+};
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+/*
+ * Threading helpers for comb-ntsc.
+ *
+ * WorkQueue is a bounded blocking FIFO for handing work between pipeline
+ * threads.
+ *
+ * push() blocks while the queue is full and pop() while it is empty.  Once
+ * close() has been called push() fails, and pop() fails as soon as the queue
+ * has drained, which is how consumer threads find out they're done.
+ *
+ * WorkPool runs a loop body over an index range on a fixed set of threads.
+ * Threads take chunks of the range off a shared counter until it runs out,
+ * so a thread that gets cheap lines just takes more of them.
+ */
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+template <typename T>
+class WorkQueue {
+	public:
+		WorkQueue(size_t _maxlen) {
+			maxlen = _maxlen;
+			closed = false;
+		}
+
+		bool push(const T &val) {
+			std::unique_lock<std::mutex> lock(mtx);
+
+			notfull.wait(lock, [this] {return closed || (q.size() < maxlen);});
+			if (closed) return false;
+
+			q.push_back(val);
+			notempty.notify_one();
+
+			return true;
+		}
+
+		bool pop(T &val) {
+			std::unique_lock<std::mutex> lock(mtx);
+
+			notempty.wait(lock, [this] {return closed || !q.empty();});
+			if (q.empty()) return false;
+
+			val = q.front();
+			q.pop_front();
+			notfull.notify_one();
+
+			return true;
+		}
+
+		void close() {
+			std::lock_guard<std::mutex> lock(mtx);
+
+			closed = true;
+			notempty.notify_all();
+			notfull.notify_all();
+		}
+
+	protected:
+		std::deque<T> q;
+		size_t maxlen;
+		bool closed;
+
+		std::mutex mtx;
+		std::condition_variable notempty, notfull;
+};
+
+class WorkPool {
+	public:
+		// the thread calling run() does its share, so nthreads - 1 are started
+		WorkPool(int nthreads) {
+			stop = false;
+			generation = 0;
+			active = 0;
+			fn = NULL;
+
+			for (int i = 1; i < nthreads; i++) {
+				threads.push_back(std::thread([this] {worker();}));
+			}
+		}
+
+		~WorkPool() {
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+
+				stop = true;
+				wake.notify_all();
+			}
+
+			for (size_t i = 0; i < threads.size(); i++) {
+				threads[i].join();
+			}
+		}
+
+		// Calls _fn(i) for start <= i < end and returns when all are done.
+		// Only one thread may be in run() at a time.
+		void run(int start, int end, const std::function<void(int)> &_fn, int _chunk = 4) {
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+
+				fn = &_fn;
+				next = start;
+				last = end;
+				chunk = _chunk;
+				active = threads.size();
+				generation++;
+				wake.notify_all();
+			}
+
+			work();
+
+			std::unique_lock<std::mutex> lock(mtx);
+			done.wait(lock, [this] {return active == 0;});
+			fn = NULL;
+		}
+
+	protected:
+		std::vector<std::thread> threads;
+
+		std::mutex mtx;
+		std::condition_variable wake, done;
+		bool stop;
+		long generation;
+		size_t active;		// pool threads still working on this generation
+
+		const std::function<void(int)> *fn;
+		std::atomic<int> next;
+		int last, chunk;
+
+		void work() {
+			for (;;) {
+				int i = next.fetch_add(chunk);
+
+				if (i >= last) return;
+
+				for (int j = i; (j < (i + chunk)) && (j < last); j++) {
+					(*fn)(j);
+				}
+			}
+		}
+
+		void worker() {
+			long seen = 0;
+			std::unique_lock<std::mutex> lock(mtx);
+
+			for (;;) {
+				wake.wait(lock, [&] {return stop || (generation != seen);});
+				if (stop) return;
+
+				seen = generation;
+				lock.unlock();
+
+				work();
+
+				lock.lock();
+				if (--active == 0) done.notify_all();
+			}
+		}
+};
+
+#endif